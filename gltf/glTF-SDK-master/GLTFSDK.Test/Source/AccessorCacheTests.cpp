@@ -0,0 +1,61 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/AccessorCache.h>
+
+using namespace glTF::UnitTest;
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(AccessorCacheTests)
+            {
+                GLTFSDK_TEST_METHOD(AccessorCacheTests, AccessorCache_Get)
+                {
+                    AccessorCache cache;
+
+                    size_t decodeCount = 0U;
+
+                    auto fnDecode = [&decodeCount]()
+                    {
+                        ++decodeCount;
+                        return std::vector<float>{ 1.0f, 2.0f, 3.0f };
+                    };
+
+                    auto data1 = cache.Get<float>("0", fnDecode);
+                    auto data2 = cache.Get<float>("0", fnDecode);
+
+                    Assert::IsTrue(data1 == data2);
+                    Assert::AreEqual<size_t>(1U, decodeCount);
+                    Assert::AreEqual<size_t>(1U, cache.GetHitCount());
+                    Assert::AreEqual<size_t>(1U, cache.GetMissCount());
+
+                    Assert::IsTrue(cache.Find<float>("0") == data1);
+                    Assert::IsFalse(static_cast<bool>(cache.Find<float>("1")));
+                }
+
+                GLTFSDK_TEST_METHOD(AccessorCacheTests, AccessorCache_KeyedByType)
+                {
+                    AccessorCache cache;
+
+                    cache.Get<uint8_t>("0", []() { return std::vector<uint8_t>{ 255U }; });
+                    cache.Get<float>("0", []() { return std::vector<float>{ 1.0f }; });
+
+                    Assert::AreEqual<size_t>(2U, cache.Size());
+                    Assert::AreEqual<uint8_t>(255U, cache.Find<uint8_t>("0")->front());
+                    Assert::AreEqual(1.0f, cache.Find<float>("0")->front());
+
+                    cache.Clear();
+
+                    Assert::AreEqual<size_t>(0U, cache.Size());
+                    Assert::IsFalse(static_cast<bool>(cache.Find<float>("0")));
+                }
+            };
+        }
+    }
+}
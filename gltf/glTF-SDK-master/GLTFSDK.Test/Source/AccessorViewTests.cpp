@@ -0,0 +1,355 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/AccessorView.h>
+#include <GLTFSDK/BufferBuilder.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/GLTFResourceWriter.h>
+
+#include "TestUtils.h"
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    using namespace Microsoft::glTF;
+    using namespace Microsoft::glTF::Test;
+
+    // Returns true if the memory referenced by the view lies within the stream's memory
+    template<typename T>
+    bool IsViewOf(const AccessorView<T>& view, const MemoryStream& stream)
+    {
+        auto viewBegin = reinterpret_cast<const uint8_t*>(view.GetElement(0U));
+        return viewBegin >= stream.Data() && viewBegin < stream.Data() + stream.Size();
+    }
+
+    // Creates a GLTFResourceReader whose stream cache is pre-populated with the specified buffer's MemoryStream
+    GLTFResourceReader CreateMemoryStreamReader(std::shared_ptr<const StreamReaderWriter> readerWriter, const Buffer& buffer, std::shared_ptr<MemoryStream>& stream)
+    {
+        auto memoryStreamReader = std::make_shared<MemoryStreamReader>(std::move(readerWriter));
+
+        stream = std::dynamic_pointer_cast<MemoryStream>(memoryStreamReader->GetInputStream(buffer.uri));
+
+        auto streamCache = MakeStreamReaderCache<StreamReaderCacheLRU>(memoryStreamReader, 16U);
+        streamCache->Set(buffer.uri, stream);
+
+        return GLTFResourceReader(std::move(streamCache));
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(AccessorViewTests)
+            {
+                GLTFSDK_TEST_METHOD(AccessorViewTests, ReadAccessorView_TightlyPacked_ReferencesMemoryStream)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    std::vector<float> positions = { 0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f };
+                    auto accessor = bufferBuilder.AddAccessor(positions, { TYPE_VEC3, COMPONENT_FLOAT });
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    std::shared_ptr<MemoryStream> stream;
+                    auto reader = CreateMemoryStreamReader(readerWriter, doc.buffers.Front(), stream);
+
+                    auto view = reader.ReadAccessorView<float>(doc, accessor);
+
+                    Assert::AreEqual<size_t>(2U, view.GetElementCount());
+                    Assert::AreEqual<size_t>(3U, view.GetTypeCount());
+                    Assert::IsTrue(view.IsTightlyPacked());
+                    Assert::IsTrue(IsViewOf(view, *stream));
+                    AreEqual(positions, std::vector<float>(view.Data(), view.Data() + view.GetComponentCount()));
+                    AreEqual(positions, view.ToVector());
+                    AreEqual(reader.ReadBinaryData<float>(doc, accessor), view.ToVector());
+                }
+
+                GLTFSDK_TEST_METHOD(AccessorViewTests, ReadAccessorView_Interleaved_ReferencesMemoryStream)
+                {
+                    struct Vertex
+                    {
+                        float position[3];
+                        uint16_t texCoord[2];
+                    };
+
+                    const Vertex vertices[] = {
+                        { { 0.0f, 1.0f, 2.0f }, { 10U, 11U } },
+                        { { 3.0f, 4.0f, 5.0f }, { 12U, 13U } },
+                        { { 6.0f, 7.0f, 8.0f }, { 14U, 15U } }
+                    };
+
+                    const AccessorDesc descs[] = {
+                        { TYPE_VEC3, COMPONENT_FLOAT, false, {}, {}, offsetof(Vertex, position) },
+                        { TYPE_VEC2, COMPONENT_UNSIGNED_SHORT, false, {}, {}, offsetof(Vertex, texCoord) }
+                    };
+
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    std::string accessorIds[2];
+                    bufferBuilder.AddAccessors(vertices, 3U, sizeof(Vertex), descs, 2U, accessorIds);
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    std::shared_ptr<MemoryStream> stream;
+                    auto reader = CreateMemoryStreamReader(readerWriter, doc.buffers.Front(), stream);
+
+                    auto positions = reader.ReadAccessorView<float>(doc, doc.accessors.Get(accessorIds[0]));
+                    auto texCoords = reader.ReadAccessorView<uint16_t>(doc, doc.accessors.Get(accessorIds[1]));
+
+                    Assert::IsFalse(positions.IsTightlyPacked());
+                    Assert::IsTrue(IsViewOf(positions, *stream));
+                    Assert::IsTrue(IsViewOf(texCoords, *stream));
+                    Assert::AreEqual(sizeof(Vertex), positions.GetByteStride());
+                    Assert::AreEqual(sizeof(Vertex), texCoords.GetByteStride());
+
+                    for (size_t i = 0U; i < 3U; ++i)
+                    {
+                        for (size_t j = 0U; j < 3U; ++j)
+                        {
+                            Assert::AreEqual(vertices[i].position[j], positions.Get(i, j));
+                        }
+
+                        for (size_t j = 0U; j < 2U; ++j)
+                        {
+                            Assert::AreEqual(vertices[i].texCoord[j], texCoords.Get(i, j));
+                        }
+                    }
+
+                    AreEqual(reader.ReadBinaryData<float>(doc, doc.accessors.Get(accessorIds[0])), positions.ToVector());
+                    AreEqual(reader.ReadBinaryData<uint16_t>(doc, doc.accessors.Get(accessorIds[1])), texCoords.ToVector());
+                }
+
+                GLTFSDK_TEST_METHOD(AccessorViewTests, AccessorView_ElementIterator)
+                {
+                    // Two 2-component uint16_t elements per 8 byte stride
+                    const uint16_t data[] = { 1U, 2U, 0U, 0U, 3U, 4U, 0U, 0U, 5U, 6U };
+
+                    AccessorView<uint16_t> view(nullptr, reinterpret_cast<const uint8_t*>(data), 3U, 2U, 8U);
+
+                    Assert::AreEqual<std::ptrdiff_t>(3, std::distance(view.begin(), view.end()));
+
+                    uint16_t expected = 1U;
+
+                    for (const uint16_t* element : view)
+                    {
+                        Assert::AreEqual<uint16_t>(expected++, element[0]);
+                        Assert::AreEqual<uint16_t>(expected++, element[1]);
+                    }
+
+                    auto it = view.end();
+
+                    Assert::AreEqual<uint16_t>(5U, (*--it)[0]);
+                    Assert::AreEqual<uint16_t>(3U, (it - 1)[0][0]);
+                    Assert::IsTrue(view.begin() + 2 == it);
+                    Assert::IsTrue(view.begin() < it);
+
+                    AreEqual(std::vector<uint16_t>{ 1U, 2U, 3U, 4U, 5U, 6U }, view.ToVector());
+                }
+
+                GLTFSDK_TEST_METHOD(AccessorViewTests, ReadAccessorView_OutlivesReader)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    std::vector<uint32_t> indices = { 0U, 1U, 2U };
+                    auto accessor = bufferBuilder.AddAccessor(indices, { TYPE_SCALAR, COMPONENT_UNSIGNED_INT });
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    AccessorView<uint32_t> view;
+
+                    {
+                        GLTFResourceReader reader(std::make_shared<MemoryStreamReader>(readerWriter));
+                        view = reader.ReadAccessorView<uint32_t>(doc, accessor);
+                    }
+
+                    // The view must keep the stream's memory alive after the reader (and its stream cache) is destroyed
+                    Assert::IsTrue(view.IsTightlyPacked());
+                    AreEqual(indices, view.ToVector());
+                }
+
+                GLTFSDK_TEST_METHOD(AccessorViewTests, ReadAccessorView_NonMemoryStream_Copies)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    std::vector<int16_t> values = { -1, 0, 1, 2 };
+                    auto accessor = bufferBuilder.AddAccessor(values, { TYPE_VEC2, COMPONENT_SHORT });
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    GLTFResourceReader reader(readerWriter);
+                    auto view = reader.ReadAccessorView<int16_t>(doc, accessor);
+
+                    Assert::AreEqual<size_t>(2U, view.GetElementCount());
+                    Assert::IsTrue(view.IsTightlyPacked());
+                    AreEqual(values, view.ToVector());
+                }
+
+                GLTFSDK_TEST_METHOD(AccessorViewTests, ReadAccessorView_Base64_Copies)
+                {
+                    Document doc;
+
+                    Buffer buffer;
+                    buffer.id = "0";
+                    buffer.byteLength = 4U;
+                    buffer.uri = "data:application/octet-stream;base64,AAECAw==";
+                    doc.buffers.Append(std::move(buffer));
+
+                    BufferView bufferView;
+                    bufferView.id = "0";
+                    bufferView.bufferId = "0";
+                    bufferView.byteLength = 4U;
+                    doc.bufferViews.Append(std::move(bufferView));
+
+                    Accessor accessor;
+                    accessor.id = "0";
+                    accessor.bufferViewId = "0";
+                    accessor.componentType = COMPONENT_UNSIGNED_BYTE;
+                    accessor.type = TYPE_SCALAR;
+                    accessor.count = 4U;
+                    doc.accessors.Append(std::move(accessor));
+
+                    GLTFResourceReader reader(std::make_shared<StreamReaderWriter>());
+                    auto view = reader.ReadAccessorView<uint8_t>(doc, doc.accessors.Front());
+
+                    AreEqual(std::vector<uint8_t>{ 0U, 1U, 2U, 3U }, view.ToVector());
+                }
+
+                GLTFSDK_TEST_METHOD(AccessorViewTests, ReadAccessorView_Sparse_Copies)
+                {
+                    // Sparse values (2 bytes), sparse indices (2 bytes) then the base data (4 bytes)
+                    const uint8_t data[] = { 7U, 9U, 1U, 3U, 0U, 0U, 0U, 0U };
+
+                    auto readerWriter = std::make_shared<StreamReaderWriter>();
+                    readerWriter->GetOutputStream("buffer.bin")->write(reinterpret_cast<const char*>(data), sizeof(data));
+
+                    Document doc;
+
+                    Buffer buffer;
+                    buffer.id = "0";
+                    buffer.byteLength = sizeof(data);
+                    buffer.uri = "buffer.bin";
+                    doc.buffers.Append(std::move(buffer));
+
+                    BufferView valuesBufferView;
+                    valuesBufferView.id = "0";
+                    valuesBufferView.bufferId = "0";
+                    valuesBufferView.byteLength = 2U;
+                    doc.bufferViews.Append(std::move(valuesBufferView));
+
+                    BufferView indicesBufferView;
+                    indicesBufferView.id = "1";
+                    indicesBufferView.bufferId = "0";
+                    indicesBufferView.byteOffset = 2U;
+                    indicesBufferView.byteLength = 2U;
+                    doc.bufferViews.Append(std::move(indicesBufferView));
+
+                    BufferView baseBufferView;
+                    baseBufferView.id = "2";
+                    baseBufferView.bufferId = "0";
+                    baseBufferView.byteOffset = 4U;
+                    baseBufferView.byteLength = 4U;
+                    doc.bufferViews.Append(std::move(baseBufferView));
+
+                    Accessor accessor;
+                    accessor.id = "0";
+                    accessor.bufferViewId = "2";
+                    accessor.componentType = COMPONENT_UNSIGNED_BYTE;
+                    accessor.type = TYPE_SCALAR;
+                    accessor.count = 4U;
+                    accessor.sparse.count = 2U;
+                    accessor.sparse.valuesBufferViewId = "0";
+                    accessor.sparse.indicesBufferViewId = "1";
+                    accessor.sparse.indicesComponentType = COMPONENT_UNSIGNED_BYTE;
+                    doc.accessors.Append(std::move(accessor));
+
+                    GLTFResourceReader reader(std::make_shared<MemoryStreamReader>(readerWriter));
+                    auto view = reader.ReadAccessorView<uint8_t>(doc, doc.accessors.Front());
+
+                    AreEqual(std::vector<uint8_t>{ 0U, 7U, 0U, 9U }, view.ToVector());
+                }
+
+                GLTFSDK_TEST_METHOD(AccessorViewTests, ReadAccessorView_StreamTooShort_Throws)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    std::vector<float> values = { 0.0f, 1.0f };
+                    bufferBuilder.AddAccessor(values, { TYPE_SCALAR, COMPONENT_FLOAT });
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    // Claim the buffer is larger than the data actually written to the stream
+                    Accessor accessor = doc.accessors.Front();
+                    accessor.count = 4U;
+
+                    BufferView bufferView = doc.bufferViews.Front();
+                    bufferView.byteLength = 16U;
+                    doc.bufferViews.Replace(bufferView);
+
+                    Buffer buffer = doc.buffers.Front();
+                    buffer.byteLength = 16U;
+                    doc.buffers.Replace(buffer);
+
+                    GLTFResourceReader reader(std::make_shared<MemoryStreamReader>(readerWriter));
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        reader.ReadAccessorView<float>(doc, accessor);
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(AccessorViewTests, ReadAccessorView_ComponentTypeMismatch_Throws)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    std::vector<float> values = { 0.0f, 1.0f };
+                    auto accessor = bufferBuilder.AddAccessor(values, { TYPE_SCALAR, COMPONENT_FLOAT });
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    GLTFResourceReader reader(std::make_shared<MemoryStreamReader>(readerWriter));
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        reader.ReadAccessorView<uint32_t>(doc, accessor);
+                    });
+                }
+            };
+        }
+    }
+}
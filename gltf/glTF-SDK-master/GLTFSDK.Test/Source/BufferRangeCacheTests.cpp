@@ -0,0 +1,143 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/BufferRangeCache.h>
+#include <GLTFSDK/Exceptions.h>
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    std::shared_ptr<const std::vector<uint8_t>> MakeData(size_t byteLength)
+    {
+        return std::make_shared<const std::vector<uint8_t>>(byteLength, static_cast<uint8_t>(byteLength));
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(BufferRangeCacheTests)
+            {
+                GLTFSDK_TEST_METHOD(BufferRangeCacheTests, BufferRangeCache_GetInsert)
+                {
+                    BufferRangeCache cache(100U);
+                    const auto sourceId = BufferRangeCache::CreateSourceId();
+
+                    Assert::IsFalse(static_cast<bool>(cache.Get(sourceId, { "0", 0U, 10U })));
+
+                    auto data = MakeData(10U);
+                    Assert::IsTrue(cache.Insert(sourceId, { "0", 0U, 10U }, data));
+
+                    Assert::IsTrue(cache.Get(sourceId, { "0", 0U, 10U }) == data);
+                    Assert::IsFalse(static_cast<bool>(cache.Get(sourceId, { "0", 0U, 9U })));
+                    Assert::IsFalse(static_cast<bool>(cache.Get(sourceId, { "1", 0U, 10U })));
+
+                    Assert::AreEqual<size_t>(10U, cache.GetByteSize());
+                    Assert::AreEqual<size_t>(1U, cache.GetHitCount());
+                    Assert::AreEqual<size_t>(3U, cache.GetMissCount());
+                    Assert::AreEqual<size_t>(0U, cache.GetEvictionCount());
+                }
+
+                GLTFSDK_TEST_METHOD(BufferRangeCacheTests, BufferRangeCache_Sources)
+                {
+                    BufferRangeCache cache(100U);
+
+                    const auto sourceId = BufferRangeCache::CreateSourceId();
+                    const auto otherSourceId = BufferRangeCache::CreateSourceId();
+                    Assert::AreNotEqual(sourceId, otherSourceId);
+
+                    // The same range of different sources (e.g. buffer "0" of two documents) is cached separately
+                    auto data = MakeData(10U);
+                    auto otherData = MakeData(20U);
+
+                    cache.Insert(sourceId, { "0", 0U, 10U }, data);
+                    Assert::IsFalse(static_cast<bool>(cache.Get(otherSourceId, { "0", 0U, 10U })));
+
+                    cache.Insert(otherSourceId, { "0", 0U, 10U }, otherData);
+
+                    Assert::IsTrue(cache.Get(sourceId, { "0", 0U, 10U }) == data);
+                    Assert::IsTrue(cache.Get(otherSourceId, { "0", 0U, 10U }) == otherData);
+                    Assert::AreEqual<size_t>(30U, cache.GetByteSize());
+                }
+
+                GLTFSDK_TEST_METHOD(BufferRangeCacheTests, BufferRangeCache_InsertReplace)
+                {
+                    BufferRangeCache cache(100U);
+                    const auto sourceId = BufferRangeCache::CreateSourceId();
+
+                    cache.Insert(sourceId, { "0", 0U, 10U }, MakeData(10U));
+                    auto data = MakeData(20U);
+                    cache.Insert(sourceId, { "0", 0U, 10U }, data);
+
+                    Assert::IsTrue(cache.Get(sourceId, { "0", 0U, 10U }) == data);
+                    Assert::AreEqual<size_t>(20U, cache.GetByteSize());
+                }
+
+                GLTFSDK_TEST_METHOD(BufferRangeCacheTests, BufferRangeCache_InsertExceedsBudget)
+                {
+                    BufferRangeCache cache(100U);
+                    const auto sourceId = BufferRangeCache::CreateSourceId();
+
+                    Assert::IsFalse(cache.Insert(sourceId, { "0", 0U, 101U }, MakeData(101U)));
+                    Assert::AreEqual<size_t>(0U, cache.GetByteSize());
+                }
+
+                GLTFSDK_TEST_METHOD(BufferRangeCacheTests, BufferRangeCache_Eviction)
+                {
+                    BufferRangeCache cache(100U);
+                    const auto sourceId = BufferRangeCache::CreateSourceId();
+
+                    for (size_t i = 0U; i < 10U; ++i)
+                    {
+                        cache.Insert(sourceId, { "0", i * 40U, 40U }, MakeData(40U));
+                        Assert::IsTrue(cache.GetByteSize() <= 100U);
+                    }
+
+                    Assert::AreEqual<size_t>(8U, cache.GetEvictionCount());
+
+                    // Only the two most recently inserted ranges remain
+                    Assert::IsTrue(static_cast<bool>(cache.Get(sourceId, { "0", 360U, 40U })));
+                    Assert::IsTrue(static_cast<bool>(cache.Get(sourceId, { "0", 320U, 40U })));
+                    Assert::IsFalse(static_cast<bool>(cache.Get(sourceId, { "0", 280U, 40U })));
+                }
+
+                GLTFSDK_TEST_METHOD(BufferRangeCacheTests, BufferRangeCache_ScanResistance)
+                {
+                    BufferRangeCache cache(100U);
+                    const auto sourceId = BufferRangeCache::CreateSourceId();
+
+                    // Request a range twice so it's promoted to the protected segment
+                    auto data = MakeData(30U);
+                    cache.Insert(sourceId, { "shared", 0U, 30U }, data);
+                    cache.Get(sourceId, { "shared", 0U, 30U });
+
+                    // A single pass over many ranges that are each only read once doesn't evict it
+                    for (size_t i = 0U; i < 100U; ++i)
+                    {
+                        cache.Insert(sourceId, { "0", i * 20U, 20U }, MakeData(20U));
+                    }
+
+                    Assert::IsTrue(cache.Get(sourceId, { "shared", 0U, 30U }) == data);
+                }
+
+                GLTFSDK_TEST_METHOD(BufferRangeCacheTests, BufferRangeCache_Clear)
+                {
+                    BufferRangeCache cache(100U);
+                    const auto sourceId = BufferRangeCache::CreateSourceId();
+
+                    cache.Insert(sourceId, { "0", 0U, 10U }, MakeData(10U));
+                    cache.Clear();
+
+                    Assert::AreEqual<size_t>(0U, cache.GetByteSize());
+                    Assert::IsFalse(static_cast<bool>(cache.Get(sourceId, { "0", 0U, 10U })));
+                }
+            };
+        }
+    }
+}
@@ -0,0 +1,108 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/Deinterleave.h>
+#include <GLTFSDK/Exceptions.h>
+
+#include <algorithm>
+#include <numeric>
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    // Checks Deinterleave against a byte by byte copy for the specified element size and stride
+    void TestDeinterleave(size_t elementSize, size_t byteStride, size_t elementCount)
+    {
+        // Only the bytes required by Deinterleave are allocated so reads past the end are detectable with ASan
+        std::vector<uint8_t> src((elementCount - 1U) * byteStride + elementSize);
+        std::iota(src.begin(), src.end(), uint8_t(0U));
+
+        std::vector<uint8_t> expected;
+
+        for (size_t i = 0U; i < elementCount; ++i)
+        {
+            expected.insert(expected.end(), src.begin() + i * byteStride, src.begin() + i * byteStride + elementSize);
+        }
+
+        std::vector<uint8_t> actual(elementCount * elementSize);
+        Microsoft::glTF::Deinterleave(src.data(), byteStride, elementCount, elementSize, actual.data());
+
+        Assert::IsTrue(expected == actual);
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(DeinterleaveTests)
+            {
+                GLTFSDK_TEST_METHOD(DeinterleaveTests, Deinterleave_CommonElementSizes)
+                {
+                    const size_t elementSizes[] = { 1U, 2U, 4U, 8U, 12U, 16U, 32U };
+
+                    for (auto elementSize : elementSizes)
+                    {
+                        TestDeinterleave(elementSize, elementSize + 4U, 1U);
+                        TestDeinterleave(elementSize, elementSize + 4U, 33U);
+                        TestDeinterleave(elementSize, elementSize * 3U, 33U);
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(DeinterleaveTests, Deinterleave_OtherElementSizes)
+                {
+                    TestDeinterleave(3U, 4U, 17U);
+                    TestDeinterleave(6U, 8U, 17U);
+                    TestDeinterleave(24U, 28U, 17U);
+                    TestDeinterleave(64U, 80U, 17U);
+                }
+
+                GLTFSDK_TEST_METHOD(DeinterleaveTests, Deinterleave_TightlyPacked)
+                {
+                    TestDeinterleave(12U, 12U, 33U);
+                }
+
+                GLTFSDK_TEST_METHOD(DeinterleaveTests, Deinterleave_StrideTooSmall_Throws)
+                {
+                    uint8_t src[16] = {};
+                    uint8_t dst[16] = {};
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        Deinterleave(src, 2U, 2U, 4U, dst);
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(DeinterleaveTests, Scatter_ElementSizes)
+                {
+                    const size_t elementSizes[] = { 1U, 2U, 3U, 4U, 8U, 12U, 16U, 24U };
+
+                    for (auto elementSize : elementSizes)
+                    {
+                        const std::vector<uint32_t> indices = { 4U, 0U, 2U, 4U };
+
+                        std::vector<uint8_t> src(indices.size() * elementSize);
+                        std::iota(src.begin(), src.end(), uint8_t(1U));
+
+                        std::vector<uint8_t> expected(5U * elementSize, 0U);
+
+                        for (size_t i = 0U; i < indices.size(); ++i)
+                        {
+                            std::copy_n(src.begin() + i * elementSize, elementSize, expected.begin() + indices[i] * elementSize);
+                        }
+
+                        std::vector<uint8_t> actual(5U * elementSize, 0U);
+                        Scatter(src.data(), indices.data(), indices.size(), elementSize, actual.data());
+
+                        Assert::IsTrue(expected == actual);
+                    }
+                }
+            };
+        }
+    }
+}
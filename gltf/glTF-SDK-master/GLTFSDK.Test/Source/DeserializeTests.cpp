@@ -4,8 +4,20 @@
 #include "stdafx.h"
 
 #include <GLTFSDK/Deserialize.h>
+#include <GLTFSDK/JsonArena.h>
+#include <GLTFSDK/SchemaValidation.h>
+#include <GLTFSDK/ThreadPool.h>
 #include <GLTFSDK/Validation.h>
 
+#include "TestUtils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
 using namespace glTF::UnitTest;
 
 namespace
@@ -275,6 +287,108 @@ namespace
     ],
     "asset": {"version": "2.0"}
 })";
+
+    const char* c_streamingDocument = R"({
+    "asset": {"version": "2.0", "generator": "DeserializeTests"},
+    "scene": 0,
+    "scenes": [ { "nodes": [0] } ],
+    "nodes": [
+        { "name": "root", "children": [1, 2], "extras": { "tags": ["a", "b"], "weight": 0.5 } },
+        { "translation": [1.0, 2.0, 3.0] },
+        { "matrix": [1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1], "extensions": { "EXT_unknown": { "value": [[1], [2]] } } }
+    ],
+    "animations": [
+        {
+            "channels": [ { "sampler": 0, "target": { "node": 1, "path": "translation" } } ],
+            "samplers": [ { "input": 0, "output": 0 } ]
+        }
+    ],
+    "accessors": [ { "bufferView": 0, "componentType": 5126, "count": 1, "type": "SCALAR" } ],
+    "bufferViews": [ { "buffer": 0, "byteLength": 4 } ],
+    "buffers": [ { "byteLength": 4, "uri": "data.bin" } ],
+    "extensionsUsed": ["EXT_unknown"],
+    "extras": { "root": true }
+})";
+}
+
+namespace
+{
+    // Runs tasks on a thread pool, after a delay, but throws instead of accepting a task once maxTaskCount have been
+    // accepted
+    class ThrowingExecutor : public Microsoft::glTF::IExecutor
+    {
+    public:
+        explicit ThrowingExecutor(size_t maxTaskCount) : m_maxTaskCount(maxTaskCount), m_taskCount(0U), m_startedCount(0U), m_threadPool(2U)
+        {
+        }
+
+        void Execute(std::function<void()> task) override
+        {
+            if (m_taskCount == m_maxTaskCount)
+            {
+                throw Microsoft::glTF::GLTFException("ThrowingExecutor has reached its task limit");
+            }
+
+            ++m_taskCount;
+
+            m_threadPool.Execute([this, task]()
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+                ++m_startedCount;
+                task();
+            });
+        }
+
+        size_t GetTaskCount() const
+        {
+            return m_taskCount;
+        }
+
+        size_t GetStartedCount() const
+        {
+            return m_startedCount;
+        }
+
+    private:
+        const size_t m_maxTaskCount;
+        size_t m_taskCount;
+        std::atomic<size_t> m_startedCount;
+
+        Microsoft::glTF::ThreadPool m_threadPool; // Destroyed first, completing any tasks referencing m_startedCount
+    };
+
+    // Creates a manifest with elementCount nodes (each the parent of the next) and elementCount accessors, large enough
+    // counts ensure DeserializeParallel parses each array as several chunks
+    std::string CreateLargeManifest(size_t elementCount)
+    {
+        std::stringstream json;
+
+        json << R"({"asset": {"version": "2.0"}, "buffers": [{"byteLength": 4}], "bufferViews": [{"buffer": 0, "byteLength": 4}], "nodes": [)";
+
+        for (size_t i = 0U; i < elementCount; ++i)
+        {
+            json << (i ? "," : "") << R"({"name": "node)" << i << R"(", "translation": [)" << i << R"(, 0, 0])";
+
+            if (i + 1U < elementCount)
+            {
+                json << R"(, "children": [)" << (i + 1U) << "]";
+            }
+
+            json << "}";
+        }
+
+        json << R"(], "accessors": [)";
+
+        for (size_t i = 0U; i < elementCount; ++i)
+        {
+            json << (i ? "," : "") << R"({"bufferView": 0, "componentType": 5126, "count": 1, "type": "SCALAR", "min": [)" << i << "]}";
+        }
+
+        json << "]}";
+
+        return json.str();
+    }
 }
 
 namespace Microsoft
@@ -522,6 +636,300 @@ namespace Microsoft
                 // TODO: Add NegativeBufferViewByteStride test
                 // TODO: Add TooLargeBufferViewByteStride test
 
+                GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeSuccess_Insitu)
+                {
+                    std::string json = c_validSamplerDocument;
+
+                    auto doc = DeserializeInsitu(&json[0]);
+
+                    // The document doesn't reference the (modified) json buffer
+                    json.assign(json.size(), ' ');
+
+                    Assert::IsTrue(doc == Deserialize(c_validSamplerDocument), L"Document deserialized in situ doesn't match the document deserialized from a string");
+                }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeSuccess_Streaming)
+                {
+                    // Without schema validation the manifest is deserialized from SAX events rather than a DOM
+                    for (const char* json : { c_validPrimitiveNoIndices, c_validAccessor, c_validSamplerDocument, c_extraFieldsJson, c_streamingDocument })
+                    {
+                        const auto expected = Deserialize(json);
+
+                        Assert::IsTrue(expected == Deserialize(json, DeserializeFlags::None, SchemaFlags::DisableSchemaRoot), L"Document deserialized from SAX events doesn't match the document deserialized from a DOM");
+
+                        std::stringstream stream(json);
+                        Assert::IsTrue(expected == Deserialize(stream, DeserializeFlags::None, SchemaFlags::DisableSchemaRoot), L"Document deserialized from a stream's SAX events doesn't match the document deserialized from a DOM");
+
+                        std::string insitu = json;
+                        Assert::IsTrue(expected == DeserializeInsitu(&insitu[0], DeserializeFlags::None, SchemaFlags::DisableSchemaRoot), L"Document deserialized in situ from SAX events doesn't match the document deserialized from a DOM");
+                    }
+
+                    auto doc = Deserialize(c_streamingDocument, DeserializeFlags::None, SchemaFlags::DisableSchemaRoot);
+
+                    Assert::AreEqual(size_t(3U), doc.nodes.Size());
+                    Assert::AreEqual(size_t(1U), doc.animations[0].channels.Size());
+                    Assert::AreEqual(std::string("0"), doc.defaultSceneId);
+                    Assert::IsTrue(doc.extensionsUsed.count("EXT_unknown") == 1U);
+                    Assert::IsFalse(doc.extras.empty());
+                    Assert::IsFalse(doc.nodes[2].extensions.empty());
+                }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeSuccess_Streaming_ByteOrderMark)
+                {
+                    const std::string json = std::string("\xEF\xBB\xBF") + c_validSamplerDocument;
+
+                    Assert::IsTrue(Deserialize(c_validSamplerDocument) == Deserialize(json, DeserializeFlags::IgnoreByteOrderMark, SchemaFlags::DisableSchemaRoot));
+
+                    std::stringstream stream(json);
+                    Assert::IsTrue(Deserialize(c_validSamplerDocument) == Deserialize(stream, DeserializeFlags::IgnoreByteOrderMark, SchemaFlags::DisableSchemaRoot));
+                }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeFail_Streaming)
+                {
+                    // The root must be an object
+                    Assert::ExpectException<GLTFException>([]()
+                    {
+                        Deserialize("[]", DeserializeFlags::None, SchemaFlags::DisableSchemaRoot);
+                    });
+
+                    Assert::ExpectException<GLTFException>([]()
+                    {
+                        Deserialize(R"({"asset": {"version": "2.0"}, "nodes": [)", DeserializeFlags::None, SchemaFlags::DisableSchemaRoot);
+                    });
+
+                    // Top level glTF object collections must be arrays
+                    Assert::ExpectException<InvalidGLTFException>([]()
+                    {
+                        Deserialize(R"({"asset": {"version": "2.0"}, "nodes": {}})", DeserializeFlags::None, SchemaFlags::DisableSchemaRoot);
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeSuccess_SkipSections)
+                {
+                    const auto flags = DeserializeFlags::SkipAnimations | DeserializeFlags::SkipExtensions | DeserializeFlags::SkipExtras;
+
+                    for (auto schemaFlags : { SchemaFlags::None, SchemaFlags::DisableSchemaRoot })
+                    {
+                        auto doc = Deserialize(c_streamingDocument, flags, schemaFlags);
+
+                        Assert::AreEqual(size_t(0U), doc.animations.Size());
+                        Assert::AreEqual(size_t(3U), doc.nodes.Size());
+                        Assert::AreEqual(size_t(1U), doc.accessors.Size());
+                        Assert::IsTrue(doc.extras.empty());
+                        Assert::IsTrue(doc.nodes[0].extras.empty());
+                        Assert::IsTrue(doc.nodes[2].extensions.empty());
+
+                        // Only the extensions themselves are skipped
+                        Assert::IsTrue(doc.extensionsUsed.count("EXT_unknown") == 1U);
+                    }
+
+                    auto doc = Deserialize(c_validSamplerDocument, DeserializeFlags::SkipMaterials | DeserializeFlags::SkipImages | DeserializeFlags::SkipSkins);
+
+                    Assert::AreEqual(size_t(2U), doc.samplers.Size());
+                }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeSuccess_Parallel)
+                {
+                    ThreadPool threadPool(4U);
+
+                    const auto json = CreateLargeManifest(1000U);
+                    const auto doc = DeserializeParallel(json, threadPool);
+
+                    Assert::IsTrue(doc == Deserialize(json), L"Document deserialized in parallel doesn't match the document deserialized serially");
+                    Assert::AreEqual(size_t(1000U), doc.nodes.Size());
+                    Assert::AreEqual(std::string("999"), doc.nodes.Back().id);
+
+                    Assert::IsTrue(DeserializeParallel(c_streamingDocument, threadPool) == Deserialize(c_streamingDocument));
+                    Assert::AreEqual(size_t(0U), DeserializeParallel(c_streamingDocument, threadPool, DeserializeFlags::SkipAnimations).animations.Size());
+                }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeFail_Parallel)
+                {
+                    ThreadPool threadPool(4U);
+
+                    // The exception thrown while parsing the invalid node is rethrown
+                    Assert::ExpectException<InvalidGLTFException>([&threadPool]()
+                    {
+                        DeserializeParallel(R"({"asset": {"version": "2.0"}, "nodes": [{}, {"scale": [1, 1]}]})", threadPool, DeserializeFlags::None, SchemaFlags::DisableSchemaRoot);
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeFail_Parallel_Executor)
+                {
+                    const auto json = CreateLargeManifest(1000U);
+
+                    ThrowingExecutor executor(3U);
+
+                    Assert::ExpectException<GLTFException>([&json, &executor]()
+                    {
+                        DeserializeParallel(json, executor);
+                    });
+
+                    // The tasks submitted before the executor threw reference the DOM, so must have run before it was destroyed
+                    Assert::AreEqual(size_t(3U), executor.GetTaskCount());
+                    Assert::AreEqual(size_t(3U), executor.GetStartedCount());
+                }
+
+                GLTFSDK_BENCHMARK_METHOD(DeserializeTests, BenchmarkDeserializeParallel)
+                {
+                    const size_t maxThreadCount = std::min(32U, std::max(1U, std::thread::hardware_concurrency()));
+
+                    for (size_t elementCount : { 100000U, 1000000U })
+                    {
+                        const auto json = CreateLargeManifest(elementCount);
+
+                        // Schema validation of the DOM isn't parallelized so is disabled to measure only the conversion. The
+                        // baseline is DeserializeParallel on a single thread so every run takes the same DOM path
+                        const auto measure = [&json](size_t threadCount)
+                        {
+                            ThreadPool threadPool(threadCount);
+
+                            return MeasureMilliseconds([&json, &threadPool]()
+                            {
+                                DeserializeParallel(json, threadPool, DeserializeFlags::None, SchemaFlags::DisableSchemaRoot);
+                            }, 1U);
+                        };
+
+                        const double serialMilliseconds = measure(1U);
+
+                        std::cout << elementCount << " nodes and accessors: DeserializeParallel, 1 thread " << serialMilliseconds << "ms" << std::endl;
+
+                        for (size_t threadCount = 2U; threadCount <= maxThreadCount; threadCount *= 2U)
+                        {
+                            const double milliseconds = measure(threadCount);
+
+                            std::cout << elementCount << " nodes and accessors: DeserializeParallel, " << threadCount << " threads " << milliseconds << "ms"
+                                << " (" << serialMilliseconds / milliseconds << "x)" << std::endl;
+                        }
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeSuccess_ValidateWhileParsing)
+                {
+                    for (const char* json : { c_validPrimitiveNoIndices, c_validAccessor, c_validSamplerDocument, c_extraFieldsJson, c_streamingDocument })
+                    {
+                        const auto expected = Deserialize(json);
+
+                        Assert::IsTrue(expected == Deserialize(json, DeserializeFlags::ValidateWhileParsing), L"Document validated while parsing doesn't match the document validated as a DOM");
+
+                        std::stringstream stream(json);
+                        Assert::IsTrue(expected == Deserialize(stream, DeserializeFlags::ValidateWhileParsing));
+
+                        std::string insitu = json;
+                        Assert::IsTrue(expected == DeserializeInsitu(&insitu[0], DeserializeFlags::ValidateWhileParsing));
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeFail_ValidateWhileParsing)
+                {
+                    // The violation is reported exactly as it is when validating a DOM
+                    Assert::ExpectException<ValidationException>([]()
+                    {
+                        try
+                        {
+                            Deserialize(c_negativeAccessorOffset, DeserializeFlags::ValidateWhileParsing);
+                        }
+                        catch (const ValidationException& ex)
+                        {
+                            Assert::AreEqual("Schema violation at #/accessors/0/byteOffset due to minimum", ex.what());
+                            throw;
+                        }
+                    });
+
+                    Assert::ExpectException<GLTFException>([]()
+                    {
+                        Deserialize(R"({"asset": {"version": "2.0"}, "nodes": [)", DeserializeFlags::ValidateWhileParsing);
+                    });
+                }
+
+                GLTFSDK_BENCHMARK_METHOD(DeserializeTests, BenchmarkDeserializeStreaming)
+                {
+                    for (size_t elementCount : { 10000U, 100000U })
+                    {
+                        const auto json = CreateLargeManifest(elementCount);
+
+                        // Schema validation of the DOM is the only remaining path that builds a DOM of the entire manifest
+                        const double domMilliseconds = MeasureMilliseconds([&json]()
+                        {
+                            Deserialize(json);
+                        });
+
+                        const double validateWhileParsingMilliseconds = MeasureMilliseconds([&json]()
+                        {
+                            Deserialize(json, DeserializeFlags::ValidateWhileParsing);
+                        });
+
+                        const double streamingMilliseconds = MeasureMilliseconds([&json]()
+                        {
+                            Deserialize(json, DeserializeFlags::None, SchemaFlags::DisableSchemaRoot);
+                        });
+
+                        std::cout << elementCount << " nodes and accessors (" << json.size() / 1024U << "KB): DOM " << domMilliseconds << "ms, "
+                            "ValidateWhileParsing " << validateWhileParsingMilliseconds << "ms, "
+                            "DisableSchemaRoot " << streamingMilliseconds << "ms" << std::endl;
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeSuccess_Arena)
+                {
+                    const auto json = CreateLargeManifest(100U);
+                    const auto expected = Deserialize(json);
+
+                    // The first manifests overflow the arena's small initial buffer so it is enlarged to fit them
+                    JsonArena arena(1024U);
+
+                    auto allocationCount = arena.GetAllocationCount();
+
+                    Assert::IsTrue(expected == Deserialize(json, arena), L"Document deserialized using an arena doesn't match the document deserialized without one");
+
+                    // The DOM's values didn't fit in the buffer so rapidjson allocated additional chunks
+                    const auto firstAllocationCount = arena.GetAllocationCount() - allocationCount;
+                    Assert::IsTrue(firstAllocationCount > 0U);
+
+                    Assert::IsTrue(expected == Deserialize(json, arena));
+                    Assert::IsTrue(arena.GetCapacity() > 1024U);
+
+                    // Subsequent manifests of the same size allocate nothing for their values. The remaining allocations
+                    // (the parse stack) are the same for every manifest.
+                    allocationCount = arena.GetAllocationCount();
+
+                    Assert::IsTrue(expected == Deserialize(json, arena));
+
+                    const auto reuseAllocationCount = arena.GetAllocationCount() - allocationCount;
+                    Assert::IsTrue(reuseAllocationCount < firstAllocationCount);
+
+                    for (size_t i = 0U; i < 10U; ++i)
+                    {
+                        allocationCount = arena.GetAllocationCount();
+
+                        Assert::IsTrue(expected == Deserialize(json, arena));
+                        Assert::AreEqual(reuseAllocationCount, arena.GetAllocationCount() - allocationCount);
+                    }
+
+                    // An invalid manifest doesn't prevent the arena being reused
+                    Assert::ExpectException<GLTFException>([&arena]()
+                    {
+                        Deserialize(R"({"asset": {"version": "2.0"}, "nodes": [)", arena);
+                    });
+
+                    Assert::IsTrue(Deserialize(c_validSamplerDocument) == Deserialize(c_validSamplerDocument, arena));
+
+                    // Capacities smaller than the minimum are rounded up, leaving room for the pool allocator's bookkeeping
+                    JsonArena smallArena(1U);
+                    Assert::AreEqual(JsonArena::MinimumCapacity, smallArena.GetCapacity());
+                    Assert::IsTrue(expected == Deserialize(json, smallArena));
+                }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, DefaultSchemaCache)
+                {
+                    // Compiled schemas are shared by every deserialization using the same schema flags
+                    const auto schemaCache = GetDefaultSchemaCache(SchemaFlags::None);
+
+                    Assert::IsTrue(schemaCache == GetDefaultSchemaCache(SchemaFlags::None));
+                    Assert::IsTrue(schemaCache != GetDefaultSchemaCache(SchemaFlags::DisableSchemaNode));
+                    Assert::IsTrue(&schemaCache->GetSchemaDocument(SCHEMA_URI_GLTF) == &schemaCache->GetSchemaDocument(SCHEMA_URI_GLTF));
+                }
+
                 GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeSuccess_DeserializeSampler)
                 {
                     auto doc = Deserialize(c_validSamplerDocument);
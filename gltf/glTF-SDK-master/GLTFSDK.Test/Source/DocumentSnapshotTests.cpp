@@ -0,0 +1,335 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/DocumentSnapshot.h>
+#include <GLTFSDK/MemoryStream.h>
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    using namespace Microsoft::glTF;
+
+    // A Document with every property set to a non default value
+    Document CreateTestDocument()
+    {
+        Document document;
+
+        document.asset.copyright = "copyright";
+        document.asset.generator = "generator";
+        document.asset.minVersion = "2.0";
+        document.asset.extras = R"({"asset": true})";
+
+        Buffer buffer;
+        buffer.id = "buffer";
+        buffer.uri = "buffer.bin";
+        buffer.byteLength = 1024U;
+        document.buffers.Append(std::move(buffer));
+
+        BufferView bufferView;
+        bufferView.id = "bufferView";
+        bufferView.name = "name";
+        bufferView.bufferId = "buffer";
+        bufferView.byteOffset = 16U;
+        bufferView.byteLength = 512U;
+        bufferView.byteStride = 12U;
+        bufferView.target = ARRAY_BUFFER;
+        document.bufferViews.Append(std::move(bufferView));
+
+        Accessor accessor;
+        accessor.id = "accessor";
+        accessor.bufferViewId = "bufferView";
+        accessor.byteOffset = 4U;
+        accessor.componentType = COMPONENT_FLOAT;
+        accessor.normalized = true;
+        accessor.count = 8U;
+        accessor.type = TYPE_VEC3;
+        accessor.min = { -1.0f, -2.0f, -3.0f };
+        accessor.max = { 1.0f, 2.0f, 3.0f };
+        accessor.sparse.count = 2U;
+        accessor.sparse.indicesBufferViewId = "bufferView";
+        accessor.sparse.indicesComponentType = COMPONENT_UNSIGNED_SHORT;
+        accessor.sparse.indicesByteOffset = 8U;
+        accessor.sparse.valuesBufferViewId = "bufferView";
+        accessor.sparse.valuesByteOffset = 32U;
+        accessor.extensions.emplace("EXT_accessor", R"({"value": 1})");
+        document.accessors.Append(std::move(accessor));
+
+        document.cameras.Append(Camera("perspective", "", std::make_unique<Perspective>(100.0f, 0.1f, 1.5f, 0.8f)));
+        document.cameras.Append(Camera("infinite", "", std::make_unique<Perspective>(0.1f, 0.8f)));
+        document.cameras.Append(Camera("orthographic", "name", std::make_unique<Orthographic>(10.0f, 0.5f, 2.0f, 3.0f)));
+
+        Image image;
+        image.id = "image";
+        image.uri = "image.png";
+        image.mimeType = "image/png";
+        document.images.Append(std::move(image));
+
+        Sampler sampler;
+        sampler.id = "sampler";
+        sampler.magFilter = MagFilter_NEAREST;
+        sampler.minFilter = MinFilter_LINEAR_MIPMAP_LINEAR;
+        sampler.wrapS = Wrap_CLAMP_TO_EDGE;
+        sampler.wrapT = Wrap_MIRRORED_REPEAT;
+        document.samplers.Append(std::move(sampler));
+
+        Texture texture;
+        texture.id = "texture";
+        texture.imageId = "image";
+        texture.samplerId = "sampler";
+        document.textures.Append(std::move(texture));
+
+        Material material;
+        material.id = "material";
+        material.metallicRoughness.baseColorFactor = Color4(0.1f, 0.2f, 0.3f, 0.4f);
+        material.metallicRoughness.baseColorTexture.textureId = "texture";
+        material.metallicRoughness.baseColorTexture.texCoord = 1U;
+        material.metallicRoughness.metallicFactor = 0.25f;
+        material.metallicRoughness.roughnessFactor = 0.75f;
+        material.metallicRoughness.extras = R"({"pbr": true})";
+        material.normalTexture.textureId = "texture";
+        material.normalTexture.scale = 2.0f;
+        material.occlusionTexture.textureId = "texture";
+        material.occlusionTexture.strength = 0.5f;
+        material.emissiveTexture.textureId = "texture";
+        material.emissiveFactor = Color3(1.0f, 0.5f, 0.25f);
+        material.alphaMode = ALPHA_MASK;
+        material.alphaCutoff = 0.25f;
+        material.doubleSided = true;
+        document.materials.Append(std::move(material));
+
+        MeshPrimitive primitive;
+        primitive.attributes.emplace(ACCESSOR_POSITION, "accessor");
+        primitive.attributes.emplace(ACCESSOR_NORMAL, "accessor");
+        primitive.indicesAccessorId = "accessor";
+        primitive.materialId = "material";
+        primitive.mode = MESH_LINES;
+        primitive.targets.push_back({ "accessor", "accessor", "" });
+
+        Mesh mesh;
+        mesh.id = "mesh";
+        mesh.primitives.push_back(primitive);
+        mesh.primitives.push_back(std::move(primitive));
+        mesh.weights = { 0.5f };
+        document.meshes.Append(std::move(mesh));
+
+        Node parent;
+        parent.id = "parent";
+        parent.children = { "child" };
+        parent.matrix.values[12] = 5.0f;
+        document.nodes.Append(std::move(parent));
+
+        Node child;
+        child.id = "child";
+        child.meshId = "mesh";
+        child.cameraId = "perspective";
+        child.skinId = "skin";
+        child.rotation = Quaternion(0.0f, 1.0f, 0.0f, 0.0f);
+        child.scale = Vector3(2.0f, 2.0f, 2.0f);
+        child.translation = Vector3(1.0f, 2.0f, 3.0f);
+        child.weights = { 0.5f };
+        document.nodes.Append(std::move(child));
+
+        Skin skin;
+        skin.id = "skin";
+        skin.inverseBindMatricesAccessorId = "accessor";
+        skin.skeletonId = "parent";
+        skin.jointIds = { "parent", "child" };
+        document.skins.Append(std::move(skin));
+
+        AnimationSampler animationSampler;
+        animationSampler.id = "0";
+        animationSampler.inputAccessorId = "accessor";
+        animationSampler.outputAccessorId = "accessor";
+        animationSampler.interpolation = INTERPOLATION_STEP;
+
+        AnimationChannel channel;
+        channel.id = "0";
+        channel.samplerId = "0";
+        channel.target.nodeId = "child";
+        channel.target.path = TARGET_TRANSLATION;
+
+        Animation animation;
+        animation.id = "animation";
+        animation.samplers.Append(std::move(animationSampler));
+        animation.channels.Append(std::move(channel));
+        document.animations.Append(std::move(animation));
+
+        Scene scene;
+        scene.id = "scene";
+        scene.nodes = { "parent" };
+        document.SetDefaultScene(std::move(scene));
+
+        document.extensionsUsed.insert("EXT_accessor");
+        document.extensionsRequired.insert("EXT_accessor");
+        document.extensions.emplace("EXT_root", "{}");
+        document.extras = R"({"root": true})";
+
+        return document;
+    }
+
+    const char* const TestExtensionName = "TEST_extension";
+    const char* const TestExtensionJson = R"({"test": true})";
+
+    class TestExtension : public Extension
+    {
+    public:
+        std::unique_ptr<Extension> Clone() const override
+        {
+            return std::make_unique<TestExtension>();
+        }
+
+        bool IsEqual(const Extension& other) const override
+        {
+            return dynamic_cast<const TestExtension*>(&other) != nullptr;
+        }
+    };
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(DocumentSnapshotTests)
+            {
+                GLTFSDK_TEST_METHOD(DocumentSnapshotTests, Snapshot_RoundTrip)
+                {
+                    const auto document = CreateTestDocument();
+                    const auto snapshot = CreateSnapshot(document);
+
+                    Assert::IsTrue(document == LoadSnapshot(snapshot.data(), snapshot.size()), L"Document loaded from a snapshot doesn't match the original");
+
+                    // Ids must be unchanged and still be usable as keys
+                    const auto loaded = LoadSnapshot(snapshot.data(), snapshot.size());
+                    Assert::AreEqual(std::string("mesh"), loaded.nodes.Get("child").meshId);
+                    Assert::AreEqual(PROJECTION_ORTHOGRAPHIC, loaded.cameras.Get("orthographic").projection->GetProjectionType());
+
+                    Assert::IsTrue(Document() == LoadSnapshot(CreateSnapshot(Document()).data(), CreateSnapshot(Document()).size()));
+                }
+
+                GLTFSDK_TEST_METHOD(DocumentSnapshotTests, Snapshot_RoundTrip_Stream)
+                {
+                    const auto document = CreateTestDocument();
+
+                    std::stringstream stream;
+                    stream << "prefix";
+                    WriteSnapshot(document, stream);
+
+                    stream.seekg(6);
+                    Assert::IsTrue(document == LoadSnapshot(stream));
+
+                    // A MemoryStream's data is used directly
+                    const auto snapshot = std::make_shared<const std::vector<uint8_t>>(CreateSnapshot(document));
+                    MemoryStream memoryStream(snapshot, snapshot->data(), snapshot->size());
+
+                    Assert::IsTrue(document == LoadSnapshot(memoryStream));
+                }
+
+                GLTFSDK_TEST_METHOD(DocumentSnapshotTests, Snapshot_Invalid)
+                {
+                    const auto snapshot = CreateSnapshot(CreateTestDocument());
+
+                    // Every truncation of the snapshot must be detected rather than read out of bounds
+                    for (size_t byteLength = 0U; byteLength < snapshot.size(); ++byteLength)
+                    {
+                        Assert::ExpectException<GLTFException>([&snapshot, byteLength]()
+                        {
+                            LoadSnapshot(snapshot.data(), byteLength);
+                        });
+                    }
+
+                    auto wrongVersion = snapshot;
+                    wrongVersion[8] = static_cast<uint8_t>(SNAPSHOT_VERSION + 1U);
+
+                    Assert::ExpectException<GLTFException>([&wrongVersion]()
+                    {
+                        LoadSnapshot(wrongVersion.data(), wrongVersion.size());
+                    });
+
+                    const std::string json = R"({"asset": {"version": "2.0"}})";
+
+                    Assert::ExpectException<GLTFException>([&json]()
+                    {
+                        LoadSnapshot(reinterpret_cast<const uint8_t*>(json.data()), json.size());
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(DocumentSnapshotTests, Snapshot_InvalidEnum)
+                {
+                    Document document;
+
+                    Sampler sampler;
+                    sampler.id = "sampler";
+                    sampler.wrapT = Wrap_MIRRORED_REPEAT;
+                    document.samplers.Append(std::move(sampler));
+
+                    auto snapshot = CreateSnapshot(document);
+
+                    // Replace the sampler's wrapT value with one that isn't a WrapMode enumerator
+                    const uint32_t wrapT = Wrap_MIRRORED_REPEAT;
+                    const auto it = std::search(snapshot.begin(), snapshot.end(), reinterpret_cast<const uint8_t*>(&wrapT), reinterpret_cast<const uint8_t*>(&wrapT + 1));
+                    Assert::IsTrue(it != snapshot.end());
+
+                    const uint32_t invalidWrapT = 12345U;
+                    std::memcpy(&*it, &invalidWrapT, sizeof(invalidWrapT));
+
+                    Assert::ExpectException<GLTFException>([&snapshot]()
+                    {
+                        LoadSnapshot(snapshot.data(), snapshot.size());
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(DocumentSnapshotTests, Snapshot_RegisteredExtension)
+                {
+                    auto document = CreateTestDocument();
+
+                    Node node;
+                    node.id = "extended";
+                    node.SetExtension<TestExtension>();
+                    document.nodes.Append(std::move(node));
+
+                    // Registered extensions can't be stored without a handler to serialize them
+                    Assert::ExpectException<GLTFException>([&document]()
+                    {
+                        CreateSnapshot(document);
+                    });
+
+                    ExtensionSerializer extensionSerializer;
+                    extensionSerializer.AddHandler<TestExtension, Node>(TestExtensionName, [](const TestExtension&, const Document&, const ExtensionSerializer&)
+                    {
+                        return std::string(TestExtensionJson);
+                    });
+
+                    const auto snapshot = CreateSnapshot(document, extensionSerializer);
+
+                    ExtensionDeserializer extensionDeserializer;
+                    extensionDeserializer.AddHandler<TestExtension, Node>(TestExtensionName, [](const std::string& json, const ExtensionDeserializer&)
+                    {
+                        Assert::AreEqual(std::string(TestExtensionJson), json);
+                        return std::make_unique<TestExtension>();
+                    });
+
+                    const auto loaded = LoadSnapshot(snapshot.data(), snapshot.size(), extensionDeserializer);
+
+                    Assert::IsTrue(document == loaded, L"Document loaded from a snapshot doesn't match the original");
+                    Assert::IsTrue(loaded.nodes.Get("extended").HasExtension<TestExtension>());
+
+                    // Without a handler the extension is loaded as an unregistered extension
+                    const auto loadedUnregistered = LoadSnapshot(snapshot.data(), snapshot.size());
+                    const auto& extendedNode = loadedUnregistered.nodes.Get("extended");
+
+                    Assert::IsFalse(extendedNode.HasExtension<TestExtension>());
+                    Assert::AreEqual(std::string(TestExtensionJson), extendedNode.extensions.at(TestExtensionName));
+                }
+            };
+        }
+    }
+}
@@ -3,13 +3,25 @@
 
 #include "stdafx.h"
 #include <GLTFSDK/Deserialize.h>
+#include <GLTFSDK/ExtensionHandlers.h>
 #include <GLTFSDK/GLBResourceReader.h>
 #include <GLTFSDK/GLBResourceWriter.h>
 #include <GLTFSDK/Serialize.h>
 #include "TestUtils.h"
 
+#include <fstream>
+#include <iterator>
+
 using namespace glTF::UnitTest;
 
+namespace
+{
+    std::string ReadAll(std::istream& stream)
+    {
+        return std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    }
+}
+
 namespace Microsoft
 {
     namespace glTF
@@ -37,6 +49,91 @@ namespace Microsoft
                     Assert::IsFalse(stream->fail());
                     Assert::IsTrue(doc == roundTrippedDoc);
                 }
+
+                GLTFSDK_TEST_METHOD(GLBResourceWriterTests, WriteBufferView_DeserializeJson)
+                {
+                    auto streamWriter = std::make_shared<const StreamReaderWriter>();
+                    GLBResourceWriter writer(streamWriter);
+                    std::string uri = "foo.glb";
+
+                    Document doc;
+                    doc.asset.generator = "GLBResourceWriterTests";
+
+                    writer.Flush(Serialize(doc, SerializeFlags::None), uri);
+
+                    GLBResourceReader resourceReader(streamWriter, streamWriter->GetInputStream(uri));
+                    Document roundTrippedDoc = resourceReader.DeserializeJson();
+
+                    Assert::IsTrue(doc == roundTrippedDoc);
+                    Assert::IsTrue(resourceReader.GetJson().empty());
+                }
+
+                GLTFSDK_TEST_METHOD(GLBResourceWriterTests, WriteBufferView_FlushDocument)
+                {
+                    auto streamWriter = std::make_shared<const StreamReaderWriter>();
+                    GLBResourceWriter writer(streamWriter);
+
+                    Document doc;
+                    doc.asset.generator = "GLBResourceWriterTests";
+
+                    std::vector<uint8_t> data = { 1U, 2U, 3U };
+
+                    BufferView bufferView;
+                    bufferView.id = "bufferView";
+                    bufferView.bufferId = GLB_BUFFER_ID;
+                    bufferView.byteLength = data.size();
+                    writer.Write(bufferView, data);
+
+                    // Flushing the document directly must produce the same GLB as flushing its serialized json
+                    writer.Flush(doc, ExtensionSerializer(), "foo.glb");
+
+                    GLBResourceWriter expectedWriter(streamWriter);
+                    expectedWriter.Write(bufferView, data);
+                    expectedWriter.Flush(Serialize(doc), "expected.glb");
+
+                    auto stream = streamWriter->GetInputStream("foo.glb");
+                    auto expectedStream = streamWriter->GetInputStream("expected.glb");
+
+                    Assert::IsTrue(ReadAll(*stream) == ReadAll(*expectedStream), L"GLB flushed from a document doesn't match the GLB flushed from its json");
+
+                    stream->seekg(0);
+
+                    GLBResourceReader resourceReader(streamWriter, stream);
+                    Assert::IsTrue(doc == resourceReader.DeserializeJson());
+                }
+
+                GLTFSDK_TEST_METHOD(GLBResourceWriterTests, WriteBufferView_TemporaryFileStream)
+                {
+                    auto streamWriter = std::make_shared<const StreamReaderWriter>();
+                    const std::string tempPath = "GLBResourceWriterTests_TemporaryFileStream.tmp";
+
+                    Document doc;
+                    doc.asset.generator = "GLBResourceWriterTests";
+
+                    std::vector<uint8_t> data = { 1U, 2U, 3U, 4U, 5U };
+
+                    BufferView bufferView;
+                    bufferView.id = "bufferView";
+                    bufferView.bufferId = GLB_BUFFER_ID;
+                    bufferView.byteLength = data.size();
+
+                    {
+                        GLBResourceWriter writer(streamWriter, std::make_unique<TemporaryFileStream>(tempPath));
+                        writer.Write(bufferView, data);
+                        writer.Flush(Serialize(doc), "foo.glb");
+
+                        Assert::IsTrue(std::ifstream(tempPath).good());
+                    }
+
+                    // The temporary file is deleted along with the writer
+                    Assert::IsFalse(std::ifstream(tempPath).good());
+
+                    GLBResourceWriter expectedWriter(streamWriter);
+                    expectedWriter.Write(bufferView, data);
+                    expectedWriter.Flush(Serialize(doc), "expected.glb");
+
+                    Assert::IsTrue(ReadAll(*streamWriter->GetInputStream("foo.glb")) == ReadAll(*streamWriter->GetInputStream("expected.glb")));
+                }
             };
         }
     }
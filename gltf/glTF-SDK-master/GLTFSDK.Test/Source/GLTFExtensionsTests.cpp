@@ -7,6 +7,7 @@
 #include <GLTFSDK/Extension.h>
 #include <GLTFSDK/ExtensionHandlers.h>
 #include <GLTFSDK/ExtensionsKHR.h>
+#include <GLTFSDK/ExtrasDocument.h>
 #include <GLTFSDK/RapidJsonUtils.h>
 #include <GLTFSDK/Serialize.h>
 #include <GLTFSDK/SchemaValidation.h>
@@ -704,6 +705,93 @@ namespace Microsoft
                     Assert::IsTrue(node.GetExtension<TestExtension>().flag, L"Node's TestExtension's flag property expected to be true");
                 }
 
+                GLTFSDK_TEST_METHOD(ExtensionsTests, ExtensionDeserializerAddValueHandler)
+                {
+                    ExtensionDeserializer extensionDeserializer;
+
+                    size_t handlerCount = 0;
+
+                    // The value handler is passed the parsed JSON value of each extension rather than a serialized string
+                    extensionDeserializer.AddValueHandler<TestExtension>(TestExtensionName,
+                        [&handlerCount](const JsonValue& json, const ExtensionDeserializer& /*extensionDeserializer*/)
+                    {
+                        ++handlerCount;
+                        return std::make_unique<TestExtension>(json.value["flag"].GetBool());
+                    });
+
+                    Assert::IsTrue(extensionDeserializer.HasHandler<TestExtension>());
+
+                    const Document document = Deserialize(expectedExtensionAddHandler, extensionDeserializer);
+
+                    Assert::AreEqual(size_t(3), handlerCount, L"Extension value handler called an unexpected number of times");
+
+                    Assert::IsFalse(document.GetExtension<TestExtension>().flag, L"Document's TestExtension's flag property expected to be false");
+                    Assert::IsTrue(document.GetDefaultScene().GetExtension<TestExtension>().flag, L"Scene's TestExtension's flag property expected to be true");
+
+                    // A value handler also deserializes an ExtensionPair, whose value is a string
+                    auto extension = extensionDeserializer.Deserialize({ TestExtensionName, R"({"flag":true})" }, Node());
+
+                    Assert::AreEqual(size_t(4), handlerCount, L"Extension value handler called an unexpected number of times");
+                    Assert::IsTrue(dynamic_cast<const TestExtension&>(*extension).flag, L"TestExtension's flag property expected to be true");
+                }
+
+                GLTFSDK_TEST_METHOD(ExtensionsTests, ExtensionDeserializerExtrasAndUnhandledExtensionHandlers)
+                {
+                    const char manifest[] = R"({
+    "asset": { "version": "2.0" },
+    "extensionsUsed": [ "EXT_unknown" ],
+    "nodes": [
+        {
+            "name": "a",
+            "extras": { "flag": true },
+            "extensions": { "EXT_unknown": { "value": 1 } }
+        },
+        {
+            "name": "b"
+        }
+    ]
+})";
+
+                    ExtensionDeserializer extensionDeserializer;
+
+                    std::vector<std::string> unhandledNames;
+
+                    // The handlers are passed the parsed values, so nothing is serialized back to a string
+                    extensionDeserializer.SetExtrasHandler([](const JsonValue& json, glTFProperty& property)
+                    {
+                        property.SetExtension<TestExtension>(ExtrasDocument(json).GetMemberValueOrDefault<bool>("flag"));
+                    });
+                    extensionDeserializer.SetUnhandledExtensionHandler([&unhandledNames](const std::string& name, const JsonValue& json, glTFProperty& /*property*/)
+                    {
+                        Assert::IsTrue(json.value.IsObject());
+                        unhandledNames.push_back(name);
+                    });
+
+                    const Document document = Deserialize(manifest, extensionDeserializer);
+
+                    const Node& nodeA = document.nodes.Get("0");
+                    const Node& nodeB = document.nodes.Get("1");
+
+                    Assert::IsTrue(nodeA.extras.empty(), L"Extras expected to be left to the extras handler");
+                    Assert::IsTrue(nodeA.extensions.empty(), L"Unhandled extensions expected to be left to the unhandled extension handler");
+                    Assert::IsTrue(nodeA.GetExtension<TestExtension>().flag, L"Node's TestExtension's flag property expected to be true");
+                    Assert::IsFalse(nodeB.HasExtension<TestExtension>(), L"Extras handler expected to be called only for properties with extras");
+
+                    Assert::AreEqual(size_t(1), unhandledNames.size());
+                    Assert::AreEqual(std::string("EXT_unknown"), unhandledNames.front());
+
+                    // Without the handlers the values are serialized as before
+                    extensionDeserializer.SetExtrasHandler(nullptr);
+                    extensionDeserializer.SetUnhandledExtensionHandler(nullptr);
+
+                    const Document documentDefault = Deserialize(manifest, extensionDeserializer);
+                    const Node& nodeDefault = documentDefault.nodes.Get("0");
+
+                    Assert::IsFalse(nodeDefault.HasExtension<TestExtension>());
+                    Assert::IsTrue(ExtrasDocument(nodeDefault.extras.c_str()).GetMemberValueOrDefault<bool>("flag"));
+                    Assert::AreEqual(size_t(1), nodeDefault.extensions.count("EXT_unknown"));
+                }
+
                 GLTFSDK_TEST_METHOD(ExtensionsTests, ExtensionDeserializerSchemaLocatorValid)
                 {
                     ExtensionDeserializer extensionDeserializer;
@@ -5,6 +5,14 @@
 
 #include <GLTFSDK/Deserialize.h>
 #include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/RandomAccessReader.h>
+#include <GLTFSDK/ThreadPool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
 
 #include "TestUtils.h"
 
@@ -798,6 +806,839 @@ namespace Microsoft
                     Assert::AreEqual<float>(data[5], -1.f);
                 }
 
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadBinaryDataInterleaved)
+                {
+                    struct Vertex
+                    {
+                        float position[3];
+                        uint32_t index;
+                        uint8_t color[4];
+                    };
+
+                    // Enough vertices that the interleaved data is read from the stream in several chunks
+                    std::vector<Vertex> vertices(100000U);
+
+                    for (size_t i = 0U; i < vertices.size(); ++i)
+                    {
+                        vertices[i] = { { i * 1.0f, i * 2.0f, i * 3.0f }, static_cast<uint32_t>(i), { uint8_t(i), uint8_t(i + 1U), uint8_t(i + 2U), uint8_t(i + 3U) } };
+                    }
+
+                    const AccessorDesc descs[] = {
+                        { TYPE_VEC3, COMPONENT_FLOAT, false, {}, {}, offsetof(Vertex, position) },
+                        { TYPE_SCALAR, COMPONENT_UNSIGNED_INT, false, {}, {}, offsetof(Vertex, index) },
+                        { TYPE_VEC4, COMPONENT_UNSIGNED_BYTE, false, {}, {}, offsetof(Vertex, color) }
+                    };
+
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    std::string accessorIds[3];
+                    bufferBuilder.AddAccessors(vertices.data(), vertices.size(), sizeof(Vertex), descs, 3U, accessorIds);
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    // Read via both the stream interface and directly from memory
+                    GLTFResourceReader readers[] = {
+                        GLTFResourceReader(readerWriter),
+                        GLTFResourceReader(std::make_shared<MemoryStreamReader>(readerWriter))
+                    };
+
+                    for (const auto& reader : readers)
+                    {
+                        auto positions = reader.ReadBinaryData<float>(doc, doc.accessors.Get(accessorIds[0]));
+                        auto indices = reader.ReadBinaryData<uint32_t>(doc, doc.accessors.Get(accessorIds[1]));
+                        auto colors = reader.ReadBinaryData<uint8_t>(doc, doc.accessors.Get(accessorIds[2]));
+
+                        Assert::AreEqual(vertices.size() * 3U, positions.size());
+                        Assert::AreEqual(vertices.size(), indices.size());
+                        Assert::AreEqual(vertices.size() * 4U, colors.size());
+
+                        for (size_t i = 0U; i < vertices.size(); ++i)
+                        {
+                            Assert::IsTrue(std::equal(vertices[i].position, vertices[i].position + 3, positions.data() + i * 3U));
+                            Assert::AreEqual(vertices[i].index, indices[i]);
+                            Assert::IsTrue(std::equal(vertices[i].color, vertices[i].color + 4, colors.data() + i * 4U));
+                        }
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadBinaryDataInterleavedBase64)
+                {
+                    Document doc;
+
+                    Buffer buffer;
+                    buffer.id = "0";
+                    buffer.byteLength = 12U;
+                    buffer.uri = "data:application/octet-stream;base64,AAECAwQFBgcICQoL";// Bytes 0 to 11
+                    doc.buffers.Append(std::move(buffer));
+
+                    BufferView bufferView;
+                    bufferView.id = "0";
+                    bufferView.bufferId = "0";
+                    bufferView.byteLength = 12U;
+                    bufferView.byteStride = 4U;
+                    doc.bufferViews.Append(std::move(bufferView));
+
+                    Accessor accessor;
+                    accessor.id = "0";
+                    accessor.bufferViewId = "0";
+                    accessor.byteOffset = 1U;
+                    accessor.componentType = COMPONENT_UNSIGNED_BYTE;
+                    accessor.type = TYPE_VEC2;
+                    accessor.count = 3U;
+                    doc.accessors.Append(std::move(accessor));
+
+                    GLTFResourceReader reader(std::make_shared<StreamReaderWriter>());
+                    auto output = reader.ReadBinaryData<uint8_t>(doc, doc.accessors.Front());
+
+                    Assert::IsTrue(output == std::vector<uint8_t>{ 1U, 2U, 5U, 6U, 9U, 10U });
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestPrefetch)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    std::vector<float> positions = { 0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f };
+                    auto positionsAccessor = bufferBuilder.AddAccessor(positions, { TYPE_VEC3, COMPONENT_FLOAT });
+
+                    std::vector<uint16_t> values = { 1U, 2U, 3U, 4U };
+                    auto valuesAccessor = bufferBuilder.AddAccessor(values, { TYPE_VEC2, COMPONENT_UNSIGNED_SHORT });
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    ReadPlan plan;
+                    plan.AddAccessor(doc, positionsAccessor);
+                    plan.AddAccessor(doc, valuesAccessor);
+
+                    reader.Prefetch(doc, plan);
+
+                    // Overwrite the buffer's stream so that reads which aren't served from memory return zeros
+                    auto bufferStream = readerWriter->GetOutputStream(doc.buffers.Front().uri);
+                    bufferStream->seekp(0);
+                    StreamUtils::WriteBinary(*bufferStream, std::vector<uint8_t>(doc.buffers.Front().byteLength, 0U));
+
+                    AreEqual(positions, reader.ReadBinaryData<float>(doc, positionsAccessor));
+                    AreEqual(values, reader.ReadBinaryData<uint16_t>(doc, valuesAccessor));
+
+                    reader.ClearPrefetched(plan);
+
+                    AreEqual(std::vector<float>(positions.size(), 0.0f), reader.ReadBinaryData<float>(doc, positionsAccessor));
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestPrefetchImage)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+
+                    const std::vector<uint8_t> imageData = { 0x89, 'P', 'N', 'G' };
+                    StreamUtils::WriteBinary(*readerWriter->GetOutputStream("image.png"), imageData);
+
+                    Document doc;
+
+                    Image image;
+                    image.id = "0";
+                    image.uri = "image.png";
+                    doc.images.Append(std::move(image));
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    ReadPlan plan;
+                    plan.AddImage(doc, doc.images.Front());
+
+                    reader.Prefetch(doc, plan);
+
+                    // Overwrite the image's stream so that reads which aren't served from memory return zeros
+                    auto imageStream = readerWriter->GetOutputStream("image.png");
+                    imageStream->seekp(0);
+                    StreamUtils::WriteBinary(*imageStream, std::vector<uint8_t>(imageData.size(), 0U));
+
+                    Assert::IsTrue(imageData == reader.ReadBinaryData(doc, doc.images.Front()));
+
+                    reader.ClearPrefetched(plan);
+
+                    Assert::IsTrue(std::vector<uint8_t>(imageData.size(), 0U) == reader.ReadBinaryData(doc, doc.images.Front()));
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestPrefetchImageRandomAccessReader)
+                {
+                    // A random access reader that counts its reads
+                    class CountingRandomAccessReader : public IRandomAccessReader
+                    {
+                    public:
+                        explicit CountingRandomAccessReader(std::shared_ptr<const IStreamReader> streamReader) : m_reader(std::move(streamReader)), readCount(0U)
+                        {
+                        }
+
+                        void ReadAt(const std::string& uri, uint64_t offset, size_t byteLength, void* data) const override
+                        {
+                            ++readCount;
+                            m_reader.ReadAt(uri, offset, byteLength, data);
+                        }
+
+                        uint64_t GetSize(const std::string& uri) const override
+                        {
+                            return m_reader.GetSize(uri);
+                        }
+
+                        StreamRandomAccessReader m_reader;
+                        mutable std::atomic<size_t> readCount;
+                    };
+
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+
+                    const std::vector<uint8_t> imageData = { 0x89, 'P', 'N', 'G' };
+                    StreamUtils::WriteBinary(*readerWriter->GetOutputStream("image.png"), imageData);
+
+                    Document doc;
+
+                    Image image;
+                    image.id = "0";
+                    image.uri = "image.png";
+                    doc.images.Append(std::move(image));
+
+                    auto randomAccessReader = std::make_shared<CountingRandomAccessReader>(readerWriter);
+
+                    GLTFResourceReader reader(readerWriter);
+                    reader.SetRandomAccessReader(randomAccessReader);
+
+                    // External images are read via the random access reader, without holding the reader's lock
+                    Assert::IsTrue(imageData == reader.ReadBinaryData(doc, doc.images.Front()));
+                    Assert::AreEqual<size_t>(1U, randomAccessReader->readCount);
+
+                    ReadPlan plan;
+                    plan.AddImage(doc, doc.images.Front());
+
+                    Assert::IsFalse(reader.Prefetch(doc, plan).IsEmpty());
+                    Assert::AreEqual<size_t>(2U, randomAccessReader->readCount);
+
+                    // The prefetched image is then served from memory
+                    Assert::IsTrue(imageData == reader.ReadBinaryData(doc, doc.images.Front()));
+                    Assert::AreEqual<size_t>(2U, randomAccessReader->readCount);
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestPrefetchThrows)
+                {
+                    // A stream reader that has no stream for missing.png
+                    class MissingImageStreamReader : public IStreamReader
+                    {
+                    public:
+                        explicit MissingImageStreamReader(std::shared_ptr<const StreamReaderWriter> streamReaderWriter) : m_streamReaderWriter(std::move(streamReaderWriter))
+                        {
+                        }
+
+                        std::shared_ptr<std::istream> GetInputStream(const std::string& uri) const override
+                        {
+                            return uri == "missing.png" ? nullptr : m_streamReaderWriter->GetInputStream(uri);
+                        }
+
+                    private:
+                        std::shared_ptr<const StreamReaderWriter> m_streamReaderWriter;
+                    };
+
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    std::vector<float> positions = { 0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f };
+                    auto positionsAccessor = bufferBuilder.AddAccessor(positions, { TYPE_VEC3, COMPONENT_FLOAT });
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    Image image;
+                    image.id = "0";
+                    image.uri = "missing.png";
+                    doc.images.Append(std::move(image));
+
+                    GLTFResourceReader reader(std::make_shared<MissingImageStreamReader>(readerWriter));
+
+                    ReadPlan plan;
+                    plan.AddAccessor(doc, positionsAccessor);
+                    plan.AddImage(doc, doc.images.Front());
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        reader.Prefetch(doc, plan);
+                    });
+
+                    // Overwrite the buffer's stream so that reads which aren't served from memory return zeros
+                    auto bufferStream = readerWriter->GetOutputStream(doc.buffers.Front().uri);
+                    bufferStream->seekp(0);
+                    StreamUtils::WriteBinary(*bufferStream, std::vector<uint8_t>(doc.buffers.Front().byteLength, 0U));
+
+                    // The range read before the image failed wasn't left prefetched
+                    AreEqual(std::vector<float>(positions.size(), 0.0f), reader.ReadBinaryData<float>(doc, positionsAccessor));
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestPrefetchOutOfBounds)
+                {
+                    Document doc;
+
+                    Buffer buffer;
+                    buffer.id = "0";
+                    buffer.byteLength = 16U;
+                    buffer.uri = "buffer.bin";
+                    doc.buffers.Append(std::move(buffer));
+
+                    ReadPlan plan;
+                    plan.AddBufferRange("0", 8U, 16U);
+
+                    GLTFResourceReader reader(std::make_shared<StreamReaderWriter>());
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        reader.Prefetch(doc, plan);
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadBinaryDataIntoBuffer)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    std::vector<float> positions = { 0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f };
+                    auto positionsAccessor = bufferBuilder.AddAccessor(positions, { TYPE_VEC3, COMPONENT_FLOAT });
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    std::vector<float> output(positions.size() + 1U, -1.0f);
+                    auto count = reader.ReadBinaryData<float>(doc, positionsAccessor, output.data(), output.size());
+
+                    Assert::AreEqual(positions.size(), count);
+                    AreEqual(positions, std::vector<float>(output.begin(), output.begin() + count));
+                    Assert::AreEqual(-1.0f, output.back());
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        reader.ReadBinaryData<float>(doc, positionsAccessor, output.data(), positions.size() - 1U);
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadFloatDataIntoBuffer)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    std::vector<uint8_t> values = { 0U, 255U, 51U, 0U };
+                    auto valuesAccessor = bufferBuilder.AddAccessor(values, { TYPE_VEC2, COMPONENT_UNSIGNED_BYTE, true });
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    std::vector<float> output(values.size());
+                    auto count = reader.ReadFloatData(doc, valuesAccessor, output.data(), output.size());
+
+                    Assert::AreEqual(values.size(), count);
+                    AreEqual(std::vector<float>{ 0.0f, 1.0f, 0.2f, 0.0f }, output);
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        reader.ReadFloatData(doc, valuesAccessor, output.data(), 2U);
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadAccessorsParallel)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    // Many small accessors sharing a single (non memory) stream maximizes contention
+                    std::vector<std::vector<float>> expected;
+
+                    for (size_t i = 0U; i < 64U; ++i)
+                    {
+                        std::vector<float> values(3U * (i + 1U));
+
+                        for (size_t j = 0U; j < values.size(); ++j)
+                        {
+                            values[j] = static_cast<float>(i * 1000U + j);
+                        }
+
+                        bufferBuilder.AddAccessor(values, { TYPE_VEC3, COMPONENT_FLOAT });
+                        expected.push_back(std::move(values));
+                    }
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    GLTFResourceReader reader(readerWriter);
+                    ThreadPool threadPool(4U);
+
+                    auto data = reader.ReadAccessorsParallel(doc, threadPool);
+
+                    Assert::AreEqual(expected.size(), data.size());
+
+                    for (size_t i = 0U; i < data.size(); ++i)
+                    {
+                        Assert::AreEqual(expected[i].size() * sizeof(float), data[i].size());
+                        Assert::IsTrue(std::memcmp(expected[i].data(), data[i].data(), data[i].size()) == 0);
+                    }
+
+                    auto subset = reader.ReadAccessorsParallel(doc, { doc.accessors[5].id, doc.accessors[2].id }, threadPool);
+
+                    Assert::AreEqual<size_t>(2U, subset.size());
+                    Assert::IsTrue(subset[0] == data[5]);
+                    Assert::IsTrue(subset[1] == data[2]);
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadAccessorsParallelException)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    std::vector<float> values = { 0.0f, 1.0f, 2.0f };
+                    bufferBuilder.AddAccessor(values, { TYPE_VEC3, COMPONENT_FLOAT });
+                    bufferBuilder.AddAccessor(values, { TYPE_VEC3, COMPONENT_FLOAT });
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    // Only the second accessor fails to decode
+                    Accessor accessor = doc.accessors[1];
+                    accessor.componentType = COMPONENT_UNKNOWN;
+                    doc.accessors.Replace(accessor);
+
+                    GLTFResourceReader reader(readerWriter);
+                    ThreadPool threadPool(2U);
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        reader.ReadAccessorsParallel(doc, threadPool);
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadAccessorsParallelUnknownId)
+                {
+                    // An executor that counts the tasks submitted to it and runs each on the calling thread
+                    class CountingExecutor : public IExecutor
+                    {
+                    public:
+                        void Execute(std::function<void()> task) override
+                        {
+                            ++taskCount;
+                            task();
+                        }
+
+                        size_t taskCount = 0U;
+                    };
+
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    std::vector<float> values = { 0.0f, 1.0f, 2.0f };
+                    bufferBuilder.AddAccessor(values, { TYPE_VEC3, COMPONENT_FLOAT });
+                    bufferBuilder.AddAccessor(values, { TYPE_VEC3, COMPONENT_FLOAT });
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    GLTFResourceReader reader(readerWriter);
+                    CountingExecutor executor;
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        reader.ReadAccessorsParallel(doc, { doc.accessors[0].id, "unknown", doc.accessors[1].id }, executor);
+                    });
+
+                    // Every id is resolved before any task is submitted
+                    Assert::AreEqual<size_t>(0U, executor.taskCount);
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadAccessorsParallelSubmitThrows)
+                {
+                    // An executor that runs tasks on a thread pool, after a delay, but throws instead of accepting a
+                    // task once maxTaskCount have been accepted
+                    class ThrowingExecutor : public IExecutor
+                    {
+                    public:
+                        explicit ThrowingExecutor(size_t maxTaskCount) : m_maxTaskCount(maxTaskCount), m_taskCount(0U), m_startedCount(0U), m_threadPool(2U)
+                        {
+                        }
+
+                        void Execute(std::function<void()> task) override
+                        {
+                            if (m_taskCount == m_maxTaskCount)
+                            {
+                                throw GLTFException("ThrowingExecutor has reached its task limit");
+                            }
+
+                            ++m_taskCount;
+
+                            m_threadPool.Execute([this, task]()
+                            {
+                                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+                                ++m_startedCount;
+                                task();
+                            });
+                        }
+
+                        size_t GetStartedCount() const
+                        {
+                            return m_startedCount;
+                        }
+
+                    private:
+                        const size_t m_maxTaskCount;
+                        size_t m_taskCount;
+                        std::atomic<size_t> m_startedCount;
+
+                        ThreadPool m_threadPool; // Destroyed first, completing any tasks referencing m_startedCount
+                    };
+
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    std::vector<float> values = { 0.0f, 1.0f, 2.0f };
+
+                    for (size_t i = 0U; i < 4U; ++i)
+                    {
+                        bufferBuilder.AddAccessor(values, { TYPE_VEC3, COMPONENT_FLOAT });
+                    }
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    GLTFResourceReader reader(readerWriter);
+                    ThrowingExecutor executor(2U);
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        reader.ReadAccessorsParallel(doc, executor);
+                    });
+
+                    // The tasks submitted before the executor threw reference the document and reader, so must have
+                    // run before ReadAccessorsParallel returned
+                    Assert::AreEqual<size_t>(2U, executor.GetStartedCount());
+                }
+
+                GLTFSDK_BENCHMARK_METHOD(GLTFResourceReaderTests, BenchmarkReadAccessorsParallel)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    // 1024 accessors of 8192 VEC3 (~96MB) all read from the same buffer
+                    const std::vector<float> values(3U * 8192U, 1.0f);
+
+                    for (size_t i = 0U; i < 1024U; ++i)
+                    {
+                        bufferBuilder.AddAccessor(values, { TYPE_VEC3, COMPONENT_FLOAT });
+                    }
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    // Reads of a MemoryStream via the random access reader don't hold any lock. The same reader is used
+                    // for the serial baseline so only the parallelism differs between runs
+                    GLTFResourceReader reader(std::make_shared<MemoryStreamReader>(readerWriter));
+                    reader.SetRandomAccessReader(std::make_shared<StreamRandomAccessReader>(std::make_shared<MemoryStreamReader>(readerWriter)));
+
+                    const double serialMilliseconds = MeasureMilliseconds([&]()
+                    {
+                        for (const auto& accessor : doc.accessors.Elements())
+                        {
+                            reader.ReadBinaryData<float>(doc, accessor);
+                        }
+                    });
+
+                    std::cout << "Serial ReadBinaryData: " << serialMilliseconds << "ms" << std::endl;
+
+                    const size_t maxThreadCount = std::min(32U, std::max(1U, std::thread::hardware_concurrency()));
+
+                    for (size_t threadCount = 1U; threadCount <= maxThreadCount; threadCount *= 2U)
+                    {
+                        ThreadPool threadPool(threadCount);
+
+                        const double milliseconds = MeasureMilliseconds([&]()
+                        {
+                            reader.ReadAccessorsParallel(doc, threadPool);
+                        });
+
+                        std::cout << "ReadAccessorsParallel, " << threadCount << " threads: " << milliseconds << "ms (" << (serialMilliseconds / milliseconds) << "x)" << std::endl;
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestBufferRangeCache)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    std::vector<float> positions = { 0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f };
+                    auto positionsAccessor = bufferBuilder.AddAccessor(positions, { TYPE_VEC3, COMPONENT_FLOAT });
+
+                    std::vector<uint16_t> values = { 1U, 2U, 3U, 4U };
+                    auto valuesAccessor = bufferBuilder.AddAccessor(values, { TYPE_VEC2, COMPONENT_UNSIGNED_SHORT });
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    auto cache = std::make_shared<BufferRangeCache>(1024U);
+
+                    GLTFResourceReader reader(readerWriter);
+                    reader.SetBufferRangeCache(cache);
+
+                    AreEqual(positions, reader.ReadBinaryData<float>(doc, positionsAccessor));
+
+                    Assert::AreEqual<size_t>(0U, cache->GetHitCount());
+                    Assert::AreEqual<size_t>(1U, cache->GetMissCount());
+                    Assert::AreEqual<size_t>(doc.bufferViews.Front().byteLength, cache->GetByteSize());
+
+                    // Overwrite the buffer's stream so that reads which aren't served from the cache return zeros
+                    auto bufferStream = readerWriter->GetOutputStream(doc.buffers.Front().uri);
+                    bufferStream->seekp(0);
+                    StreamUtils::WriteBinary(*bufferStream, std::vector<uint8_t>(doc.buffers.Front().byteLength, 0U));
+
+                    // Both accessors share a buffer view so the second accessor is read from the cache
+                    AreEqual(values, reader.ReadBinaryData<uint16_t>(doc, valuesAccessor));
+                    AreEqual(positions, reader.ReadBinaryData<float>(doc, positionsAccessor));
+
+                    Assert::AreEqual<size_t>(2U, cache->GetHitCount());
+                    Assert::AreEqual<size_t>(1U, cache->GetMissCount());
+
+                    reader.SetBufferRangeCache(nullptr);
+
+                    AreEqual(std::vector<float>(positions.size(), 0.0f), reader.ReadBinaryData<float>(doc, positionsAccessor));
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestBufferRangeCacheSharedByDocuments)
+                {
+                    auto cache = std::make_shared<BufferRangeCache>(1024U);
+
+                    // Two documents whose buffers, buffer views and accessors have the same ids but different data
+                    auto readDocument = [&cache](const std::vector<float>& positions)
+                    {
+                        auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                        auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                        bufferBuilder.AddBuffer();
+                        bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                        auto accessor = bufferBuilder.AddAccessor(positions, { TYPE_VEC3, COMPONENT_FLOAT });
+
+                        Document doc;
+                        bufferBuilder.Output(doc);
+
+                        GLTFResourceReader reader(readerWriter);
+                        reader.SetBufferRangeCache(cache);
+
+                        return reader.ReadBinaryData<float>(doc, accessor);
+                    };
+
+                    const std::vector<float> positions = { 0.0f, 1.0f, 2.0f };
+                    const std::vector<float> otherPositions = { 3.0f, 4.0f, 5.0f };
+
+                    AreEqual(positions, readDocument(positions));
+                    AreEqual(otherPositions, readDocument(otherPositions));
+
+                    Assert::AreEqual<size_t>(0U, cache->GetHitCount());
+                    Assert::AreEqual<size_t>(2U, cache->GetMissCount());
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestAccessorCache)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    std::vector<float> times = { 0.0f, 0.5f, 1.0f };
+                    auto timesAccessor = bufferBuilder.AddAccessor(times, { TYPE_SCALAR, COMPONENT_FLOAT });
+
+                    std::vector<uint8_t> values = { 0U, 255U };
+                    auto valuesAccessor = bufferBuilder.AddAccessor(values, { TYPE_SCALAR, COMPONENT_UNSIGNED_BYTE, true });
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    auto cache = std::make_shared<AccessorCache>();
+
+                    GLTFResourceReader reader(readerWriter);
+                    reader.SetAccessorCache(cache);
+
+                    auto sharedTimes = reader.ReadBinaryDataShared<float>(doc, timesAccessor);
+                    auto sharedValues = reader.ReadFloatDataShared(doc, valuesAccessor);
+
+                    AreEqual(times, *sharedTimes);
+                    AreEqual(std::vector<float>{ 0.0f, 1.0f }, *sharedValues);
+
+                    // Overwrite the buffer's stream so that reads which aren't served from the cache return zeros
+                    auto bufferStream = readerWriter->GetOutputStream(doc.buffers.Front().uri);
+                    bufferStream->seekp(0);
+                    StreamUtils::WriteBinary(*bufferStream, std::vector<uint8_t>(doc.buffers.Front().byteLength, 0U));
+
+                    Assert::IsTrue(sharedTimes == reader.ReadBinaryDataShared<float>(doc, timesAccessor));
+                    AreEqual(times, reader.ReadFloatData(doc, timesAccessor));
+                    AreEqual(std::vector<float>{ 0.0f, 1.0f }, reader.ReadFloatData(doc, valuesAccessor));
+
+                    std::vector<float> output(times.size());
+                    reader.ReadBinaryData<float>(doc, timesAccessor, output.data(), output.size());
+                    AreEqual(times, output);
+
+                    Assert::AreEqual<size_t>(2U, cache->Size());
+                    Assert::AreEqual<size_t>(2U, cache->GetMissCount());
+
+                    // The raw data of the normalized accessor was never cached so it's read from the stream
+                    AreEqual(std::vector<uint8_t>{ 0U, 0U }, reader.ReadBinaryData<uint8_t>(doc, valuesAccessor));
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestAccessorCacheComponentTypeMismatch)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    std::vector<uint16_t> values = { 0U, 65535U };
+                    auto valuesAccessor = bufferBuilder.AddAccessor(values, { TYPE_SCALAR, COMPONENT_UNSIGNED_SHORT, true });
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    GLTFResourceReader reader(readerWriter);
+                    reader.SetAccessorCache(std::make_shared<AccessorCache>());
+
+                    // The normalized data is cached as floats but the accessor's component type still isn't float
+                    AreEqual(std::vector<float>{ 0.0f, 1.0f }, reader.ReadFloatData(doc, valuesAccessor));
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        reader.ReadBinaryData<float>(doc, valuesAccessor);
+                    });
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        reader.ReadBinaryDataShared<float>(doc, valuesAccessor);
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadBinaryDataAsync)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    std::vector<float> positions = { 0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f };
+                    auto positionsAccessor = bufferBuilder.AddAccessor(positions, { TYPE_VEC3, COMPONENT_FLOAT });
+
+                    std::vector<uint8_t> values = { 0U, 255U };
+                    auto valuesAccessor = bufferBuilder.AddAccessor(values, { TYPE_SCALAR, COMPONENT_UNSIGNED_BYTE, true });
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    GLTFResourceReader reader(readerWriter);
+                    reader.SetExecutor(std::make_shared<ThreadPool>(2U));
+
+                    ReadPlan plan;
+                    plan.AddAccessor(doc, positionsAccessor);
+
+                    auto prefetchFuture = reader.PrefetchAsync(doc, plan);
+                    auto positionsFuture = reader.ReadBinaryDataAsync<float>(doc, positionsAccessor);
+                    auto valuesFuture = reader.ReadFloatDataAsync(doc, valuesAccessor);
+                    auto bufferViewFuture = reader.ReadBinaryDataAsync<uint8_t>(doc, doc.bufferViews.Front());
+
+                    prefetchFuture.get();
+
+                    AreEqual(positions, positionsFuture.get());
+                    AreEqual(std::vector<float>{ 0.0f, 1.0f }, valuesFuture.get());
+                    Assert::AreEqual<size_t>(doc.bufferViews.Front().byteLength, bufferViewFuture.get().size());
+
+                    // Reading the accessor as the wrong type fails, the exception is rethrown by future::get
+                    auto invalidFuture = reader.ReadBinaryDataAsync<uint16_t>(doc, positionsAccessor);
+
+                    Assert::ExpectException<GLTFException>([&invalidFuture]()
+                    {
+                        invalidFuture.get();
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadBinaryDataAsyncExecutor)
+                {
+                    // An executor that runs each task immediately, on the calling thread
+                    class InlineExecutor : public IExecutor
+                    {
+                    public:
+                        void Execute(std::function<void()> task) override
+                        {
+                            ++taskCount;
+                            task();
+                        }
+
+                        size_t taskCount = 0U;
+                    };
+
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    std::vector<float> positions = { 0.0f, 1.0f, 2.0f };
+                    auto positionsAccessor = bufferBuilder.AddAccessor(positions, { TYPE_VEC3, COMPONENT_FLOAT });
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    auto executor = std::make_shared<InlineExecutor>();
+
+                    GLTFResourceReader reader(readerWriter);
+                    reader.SetExecutor(executor);
+
+                    auto future = reader.ReadBinaryDataAsync<float>(doc, positionsAccessor);
+
+                    Assert::AreEqual<size_t>(1U, executor->taskCount);
+                    AreEqual(positions, future.get());
+
+                    // Without an executor the reader's default thread pool is used
+                    reader.SetExecutor(nullptr);
+
+                    AreEqual(positions, reader.ReadBinaryDataAsync<float>(doc, positionsAccessor).get());
+                    Assert::AreEqual<size_t>(1U, executor->taskCount);
+                }
             };
         }
     }
@@ -629,6 +629,16 @@ namespace Microsoft
                         Assert::IsTrue(documentWithBom == documentWithoutBom, L"Deserialized asset with utf8 BOM doesn't match asset without utf8 BOM");
                     }
 
+                    // Test the in situ overload of Deserialize
+                    {
+                        std::string json = std::string(assetBom) + asset;
+
+                        auto documentWithBom = DeserializeInsitu(&json[0], DeserializeFlags::IgnoreByteOrderMark);
+                        auto documentWithoutBom = Deserialize(asset);
+
+                        Assert::IsTrue(documentWithBom == documentWithoutBom, L"Deserialized asset with utf8 BOM doesn't match asset without utf8 BOM");
+                    }
+
                     // Test the overload of Deserialize that accepts a string
                     Assert::ExpectException<GLTFException>([]
                     {
@@ -652,6 +662,15 @@ namespace Microsoft
                         // If the IgnoreByteOrderMark flag isn't specified then a BOM should result in Deserialize throwing an exception
                         Deserialize(ss, DeserializeFlags::None);
                     });
+
+                    // Test the in situ overload of Deserialize
+                    Assert::ExpectException<GLTFException>([]
+                    {
+                        std::string json = std::string(assetBom) + asset;
+
+                        // If the IgnoreByteOrderMark flag isn't specified then a BOM should result in Deserialize throwing an exception
+                        DeserializeInsitu(&json[0], DeserializeFlags::None);
+                    });
                 }
 
                 GLTFSDK_TEST_METHOD(GLTFTests, SchemaFlagsNone)
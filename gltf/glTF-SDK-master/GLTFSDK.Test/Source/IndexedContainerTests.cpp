@@ -332,6 +332,56 @@ namespace Microsoft
                         container.Append({ "2", 0 }, AppendIdPolicy::GenerateOnEmpty);
                     }, L"IndexedContainer did not throw the expected exception when appending an item with a duplicate string id");
                 }
+
+                GLTFSDK_TEST_METHOD(IndexedContainerTests, IndexedContainer_Test_Handle)
+                {
+                    auto container = GetSampleContainer();
+
+                    const auto handle = container.GetHandle("foo4");
+
+                    Assert::AreEqual(size_t(2U), handle.index);
+                    Assert::AreEqual(uint8_t(4U), container.Get(handle).value);
+                    Assert::AreEqual(uint8_t(4U), container[handle].value);
+
+                    container.Get(handle).value = 5U;
+                    Assert::AreEqual(uint8_t(5U), container.Get("foo4").value);
+
+                    const auto& constContainer = container;
+                    Assert::AreEqual(uint8_t(5U), constContainer.Get(handle).value);
+
+                    Assert::ExpectException<GLTFException>([&container]()
+                    {
+                        container.Get(Handle<Uint8WithId>{ 6U });
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(IndexedContainerTests, IndexedContainer_Test_GeneratedIds)
+                {
+                    IndexedContainer<Uint8WithId> container;
+
+                    for (uint8_t i = 0U; i < 12U; ++i)
+                    {
+                        container.Append({ {}, i }, AppendIdPolicy::GenerateOnEmpty);
+                    }
+
+                    Assert::AreEqual(size_t(11U), container.GetIndex("11"));
+                    Assert::IsTrue(container.Has("11"));
+                    Assert::IsFalse(container.Has("12"));
+                    Assert::IsFalse(container.Has("011"));
+
+                    // After a removal generated ids no longer match the element's index
+                    container.Remove("3");
+
+                    Assert::AreEqual(size_t(3U), container.GetIndex("4"));
+                    Assert::AreEqual(uint8_t(11U), container.Get("11").value);
+                    Assert::IsFalse(container.Has("3"));
+                    Assert::IsFalse(container.Has("11+"));
+
+                    Assert::ExpectException<GLTFException>([&container]()
+                    {
+                        container.GetIndex("3");
+                    });
+                }
             };
         }
     }
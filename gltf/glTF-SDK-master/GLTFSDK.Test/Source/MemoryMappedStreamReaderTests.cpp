@@ -0,0 +1,149 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/Exceptions.h>
+#include <GLTFSDK/MemoryMappedStreamReader.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    // Writes a file to the working directory and deletes it on destruction
+    class TemporaryFile
+    {
+    public:
+        TemporaryFile(std::string name, const std::vector<uint8_t>& data) : m_name(std::move(name))
+        {
+            std::ofstream file(m_name, std::ios::binary);
+            file.write(reinterpret_cast<const char*>(data.data()), data.size());
+        }
+
+        ~TemporaryFile()
+        {
+            std::remove(m_name.c_str());
+        }
+
+        const std::string& GetName() const
+        {
+            return m_name;
+        }
+
+    private:
+        std::string m_name;
+    };
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(MemoryMappedStreamReaderTests)
+            {
+                GLTFSDK_TEST_METHOD(MemoryMappedStreamReaderTests, MemoryStream_Read)
+                {
+                    const uint8_t data[] = { 0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U };
+
+                    MemoryStream stream(nullptr, data, sizeof(data));
+
+                    Assert::IsTrue(stream.Data() == data);
+                    Assert::AreEqual(sizeof(data), stream.Size());
+
+                    uint8_t buffer[4] = {};
+
+                    stream.seekg(2, std::ios::beg);
+                    stream.read(reinterpret_cast<char*>(buffer), 4);
+
+                    Assert::IsTrue(stream.good());
+                    Assert::AreEqual<std::streamoff>(6, stream.tellg());
+                    Assert::AreEqual<uint8_t>(2U, buffer[0]);
+                    Assert::AreEqual<uint8_t>(5U, buffer[3]);
+
+                    stream.seekg(-3, std::ios::cur);
+                    stream.read(reinterpret_cast<char*>(buffer), 1);
+
+                    Assert::AreEqual<uint8_t>(3U, buffer[0]);
+
+                    stream.seekg(-1, std::ios::end);
+                    stream.read(reinterpret_cast<char*>(buffer), 1);
+
+                    Assert::AreEqual<uint8_t>(7U, buffer[0]);
+                }
+
+                GLTFSDK_TEST_METHOD(MemoryMappedStreamReaderTests, MemoryStream_ReadPastEnd_Fails)
+                {
+                    const uint8_t data[] = { 0U, 1U, 2U, 3U };
+
+                    MemoryStream stream(nullptr, data, sizeof(data));
+
+                    uint8_t buffer[8] = {};
+
+                    stream.read(reinterpret_cast<char*>(buffer), sizeof(buffer));
+
+                    Assert::IsTrue(stream.fail());
+                    Assert::AreEqual<std::streamsize>(4, stream.gcount());
+                }
+
+                GLTFSDK_TEST_METHOD(MemoryMappedStreamReaderTests, MemoryStream_SeekOutOfBounds_Fails)
+                {
+                    const uint8_t data[] = { 0U, 1U, 2U, 3U };
+
+                    MemoryStream stream(nullptr, data, sizeof(data));
+
+                    stream.seekg(5, std::ios::beg);
+
+                    Assert::IsTrue(stream.fail());
+                }
+
+                GLTFSDK_TEST_METHOD(MemoryMappedStreamReaderTests, MemoryMappedStreamReader_GetInputStream)
+                {
+                    const std::vector<uint8_t> data = { 10U, 20U, 30U, 40U, 50U };
+
+                    TemporaryFile file("MemoryMappedStreamReaderTests.bin", data);
+
+                    MemoryMappedStreamReader reader;
+
+                    auto stream = std::dynamic_pointer_cast<MemoryStream>(reader.GetInputStream(file.GetName()));
+
+                    Assert::IsTrue(static_cast<bool>(stream));
+                    Assert::AreEqual(data.size(), stream->Size());
+                    Assert::IsTrue(std::equal(data.begin(), data.end(), stream->Data()));
+
+                    std::vector<uint8_t> contents(data.size());
+                    stream->read(reinterpret_cast<char*>(contents.data()), contents.size());
+
+                    Assert::IsTrue(data == contents);
+                }
+
+                GLTFSDK_TEST_METHOD(MemoryMappedStreamReaderTests, MemoryMappedStreamReader_GetInputStream_EmptyFile)
+                {
+                    TemporaryFile file("MemoryMappedStreamReaderTests.empty.bin", {});
+
+                    MemoryMappedStreamReader reader;
+
+                    auto stream = std::dynamic_pointer_cast<MemoryStream>(reader.GetInputStream(file.GetName()));
+
+                    Assert::IsTrue(static_cast<bool>(stream));
+                    Assert::AreEqual<size_t>(0U, stream->Size());
+                }
+
+                GLTFSDK_TEST_METHOD(MemoryMappedStreamReaderTests, MemoryMappedStreamReader_GetInputStream_MissingFile_Throws)
+                {
+                    MemoryMappedStreamReader reader;
+
+                    Assert::ExpectException<GLTFException>([&reader]()
+                    {
+                        reader.GetInputStream("MemoryMappedStreamReaderTests.missing.bin");
+                    });
+                }
+            };
+        }
+    }
+}
@@ -9,6 +9,7 @@
 #include <GLTFSDK/GLTFResourceWriter.h>
 #include <GLTFSDK/IStreamWriter.h>
 #include <GLTFSDK/MeshPrimitiveUtils.h>
+#include <GLTFSDK/ReadPlan.h>
 
 #include "TestUtils.h"
 
@@ -1709,6 +1710,170 @@ namespace Microsoft
 
                     AreEqual(outputIndices, indices);
                 }
+
+                GLTFSDK_TEST_METHOD(MeshPrimitiveUtilsTests, MeshPrimitiveUtils_Test_ReadPrimitive)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+
+                    bufferBuilder.AddBufferView(BufferViewTarget::ELEMENT_ARRAY_BUFFER);
+                    std::vector<uint16_t> indices = { 0U, 1U, 2U };
+                    auto indicesAccessor = bufferBuilder.AddAccessor(indices, { TYPE_SCALAR, COMPONENT_UNSIGNED_SHORT });
+
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                    std::vector<float> positions = { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+                    auto positionsAccessor = bufferBuilder.AddAccessor(positions, { TYPE_VEC3, COMPONENT_FLOAT });
+                    std::vector<float> normals = { 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f };
+                    auto normalsAccessor = bufferBuilder.AddAccessor(normals, { TYPE_VEC3, COMPONENT_FLOAT });
+                    std::vector<uint8_t> texCoords = { 0U, 0U, 255U, 0U, 0U, 255U };
+                    auto texCoordsAccessor = bufferBuilder.AddAccessor(texCoords, { TYPE_VEC2, COMPONENT_UNSIGNED_BYTE, true });
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    MeshPrimitive meshPrimitive;
+                    meshPrimitive.indicesAccessorId = indicesAccessor.id;
+                    meshPrimitive.attributes[ACCESSOR_POSITION] = positionsAccessor.id;
+                    meshPrimitive.attributes[ACCESSOR_NORMAL] = normalsAccessor.id;
+                    meshPrimitive.attributes[ACCESSOR_TEXCOORD_0] = texCoordsAccessor.id;
+
+                    GLTFResourceReader reader(readerWriter);
+                    auto data = MeshPrimitiveUtils::ReadPrimitive(doc, reader, meshPrimitive);
+
+                    AreEqual(std::vector<uint32_t>{ 0U, 1U, 2U }, data.indices);
+                    AreEqual(positions, data.positions);
+                    AreEqual(normals, data.normals);
+                    AreEqual(std::vector<float>{ 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f }, data.texCoords0);
+
+                    Assert::IsTrue(data.tangents.empty());
+                    Assert::IsTrue(data.texCoords1.empty());
+                    Assert::IsTrue(data.colors0.empty());
+                    Assert::IsTrue(data.jointIndices0.empty());
+                    Assert::IsTrue(data.jointWeights0.empty());
+                }
+
+                GLTFSDK_TEST_METHOD(MeshPrimitiveUtilsTests, MeshPrimitiveUtils_Test_ReadPrimitive_Prefetched)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                    std::vector<float> positions = { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+                    auto positionsAccessor = bufferBuilder.AddAccessor(positions, { TYPE_VEC3, COMPONENT_FLOAT });
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    MeshPrimitive meshPrimitive;
+                    meshPrimitive.attributes[ACCESSOR_POSITION] = positionsAccessor.id;
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    ReadPlan plan;
+                    plan.AddAccessor(doc, positionsAccessor);
+
+                    // Only ranges that weren't already in memory are reported as prefetched
+                    Assert::IsFalse(reader.Prefetch(doc, plan).IsEmpty());
+                    Assert::IsTrue(reader.Prefetch(doc, plan).IsEmpty());
+
+                    AreEqual(positions, MeshPrimitiveUtils::ReadPrimitive(doc, reader, meshPrimitive).positions);
+
+                    // Overwrite the buffer's stream so that reads which aren't served from memory return zeros
+                    auto bufferStream = readerWriter->GetOutputStream(doc.buffers.Front().uri);
+                    bufferStream->seekp(0);
+                    StreamUtils::WriteBinary(*bufferStream, std::vector<uint8_t>(doc.buffers.Front().byteLength, 0U));
+
+                    // ReadPrimitive must not have released the caller's prefetched range
+                    AreEqual(positions, reader.ReadBinaryData<float>(doc, positionsAccessor));
+                }
+
+                GLTFSDK_TEST_METHOD(MeshPrimitiveUtilsTests, MeshPrimitiveUtils_Test_ReadPrimitive_PrefetchedSubrange)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+
+                    // Both accessors share a buffer view so the primitive's plan is a single range containing the positions
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                    std::vector<float> positions = { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+                    auto positionsAccessor = bufferBuilder.AddAccessor(positions, { TYPE_VEC3, COMPONENT_FLOAT });
+                    std::vector<float> normals = { 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f };
+                    auto normalsAccessor = bufferBuilder.AddAccessor(normals, { TYPE_VEC3, COMPONENT_FLOAT });
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    MeshPrimitive meshPrimitive;
+                    meshPrimitive.attributes[ACCESSOR_POSITION] = positionsAccessor.id;
+                    meshPrimitive.attributes[ACCESSOR_NORMAL] = normalsAccessor.id;
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    ReadPlan plan;
+                    plan.AddAccessor(doc, positionsAccessor);
+                    reader.Prefetch(doc, plan);
+
+                    auto data = MeshPrimitiveUtils::ReadPrimitive(doc, reader, meshPrimitive);
+                    AreEqual(positions, data.positions);
+                    AreEqual(normals, data.normals);
+
+                    // Overwrite the buffer's stream so that reads which aren't served from memory return zeros
+                    auto bufferStream = readerWriter->GetOutputStream(doc.buffers.Front().uri);
+                    bufferStream->seekp(0);
+                    StreamUtils::WriteBinary(*bufferStream, std::vector<uint8_t>(doc.buffers.Front().byteLength, 0U));
+
+                    // The caller's range lies within the range ReadPrimitive prefetched, only the latter is released
+                    AreEqual(positions, reader.ReadBinaryData<float>(doc, positionsAccessor));
+                    AreEqual(std::vector<float>(normals.size(), 0.0f), reader.ReadBinaryData<float>(doc, normalsAccessor));
+                }
+
+                GLTFSDK_TEST_METHOD(MeshPrimitiveUtilsTests, MeshPrimitiveUtils_Test_ReadIntoBuffer)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+
+                    bufferBuilder.AddBufferView(BufferViewTarget::ELEMENT_ARRAY_BUFFER);
+                    std::vector<uint8_t> indices = { 0U, 1U, 2U };
+                    auto indicesAccessor = bufferBuilder.AddAccessor(indices, { TYPE_SCALAR, COMPONENT_UNSIGNED_BYTE });
+
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                    std::vector<float> positions = { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+                    auto positionsAccessor = bufferBuilder.AddAccessor(positions, { TYPE_VEC3, COMPONENT_FLOAT });
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    MeshPrimitive meshPrimitive;
+                    meshPrimitive.indicesAccessorId = indicesAccessor.id;
+                    meshPrimitive.attributes[ACCESSOR_POSITION] = positionsAccessor.id;
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    std::vector<uint32_t> outputIndices(indices.size());
+                    Assert::AreEqual(indices.size(), MeshPrimitiveUtils::GetIndices32(doc, reader, meshPrimitive, outputIndices.data(), outputIndices.size()));
+                    AreEqual(std::vector<uint32_t>{ 0U, 1U, 2U }, outputIndices);
+
+                    std::vector<float> outputPositions(positions.size());
+                    Assert::AreEqual(positions.size(), MeshPrimitiveUtils::GetPositions(doc, reader, meshPrimitive, outputPositions.data(), outputPositions.size()));
+                    AreEqual(positions, outputPositions);
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        MeshPrimitiveUtils::GetIndices16(doc, reader, meshPrimitive, reinterpret_cast<uint16_t*>(outputIndices.data()), 2U);
+                    });
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        MeshPrimitiveUtils::GetPositions(doc, reader, meshPrimitive, outputPositions.data(), 3U);
+                    });
+                }
             };
         }
     }
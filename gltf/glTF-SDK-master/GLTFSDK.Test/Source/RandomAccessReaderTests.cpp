@@ -0,0 +1,147 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/BufferBuilder.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/GLTFResourceWriter.h>
+#include <GLTFSDK/MemoryMappedStreamReader.h>
+#include <GLTFSDK/RandomAccessReader.h>
+
+#include "TestUtils.h"
+
+#include <cstdio>
+#include <fstream>
+#include <numeric>
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    // Writes a file to the working directory and deletes it on destruction
+    class TemporaryFile
+    {
+    public:
+        TemporaryFile(std::string name, const std::vector<uint8_t>& data) : m_name(std::move(name))
+        {
+            std::ofstream file(m_name, std::ios::binary);
+            file.write(reinterpret_cast<const char*>(data.data()), data.size());
+        }
+
+        ~TemporaryFile()
+        {
+            std::remove(m_name.c_str());
+        }
+
+        const std::string& GetName() const
+        {
+            return m_name;
+        }
+
+    private:
+        std::string m_name;
+    };
+
+    std::vector<uint8_t> MakeSequentialData(size_t byteCount)
+    {
+        std::vector<uint8_t> data(byteCount);
+        std::iota(data.begin(), data.end(), uint8_t(0U));
+        return data;
+    }
+
+    // Checks reads at the start, middle and end of a resource containing MakeSequentialData(256U)
+    void TestReadAt(const Microsoft::glTF::IRandomAccessReader& reader, const std::string& uri)
+    {
+        using namespace Microsoft::glTF;
+
+        Assert::AreEqual<uint64_t>(256U, reader.GetSize(uri));
+
+        std::vector<uint8_t> data(16U);
+
+        reader.ReadAt(uri, 0U, data.size(), data.data());
+        Assert::AreEqual<uint8_t>(0U, data.front());
+
+        // Reads are independent of each other, there is no stream position
+        reader.ReadAt(uri, 100U, data.size(), data.data());
+        Assert::AreEqual<uint8_t>(100U, data.front());
+        Assert::AreEqual<uint8_t>(115U, data.back());
+
+        reader.ReadAt(uri, 240U, data.size(), data.data());
+        Assert::AreEqual<uint8_t>(255U, data.back());
+
+        Assert::ExpectException<GLTFException>([&]()
+        {
+            reader.ReadAt(uri, 241U, data.size(), data.data());
+        });
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(RandomAccessReaderTests)
+            {
+                GLTFSDK_TEST_METHOD(RandomAccessReaderTests, FileRandomAccessReader_ReadAt)
+                {
+                    TemporaryFile file("RandomAccessReaderTests_ReadAt.bin", MakeSequentialData(256U));
+
+                    FileRandomAccessReader reader;
+
+                    TestReadAt(reader, file.GetName());
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        reader.GetSize("RandomAccessReaderTests_NonExistent.bin");
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(RandomAccessReaderTests, StreamRandomAccessReader_ReadAt)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    StreamUtils::WriteBinary(*readerWriter->GetOutputStream("buffer.bin"), MakeSequentialData(256U));
+
+                    TestReadAt(StreamRandomAccessReader(readerWriter), "buffer.bin");
+                }
+
+                GLTFSDK_TEST_METHOD(RandomAccessReaderTests, StreamRandomAccessReader_ReadAt_MemoryStream)
+                {
+                    TemporaryFile file("RandomAccessReaderTests_MemoryStream.bin", MakeSequentialData(256U));
+
+                    TestReadAt(StreamRandomAccessReader(std::make_shared<MemoryMappedStreamReader>()), file.GetName());
+                }
+
+                GLTFSDK_TEST_METHOD(RandomAccessReaderTests, GLTFResourceReader_SetRandomAccessReader)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    std::vector<float> positions = { 0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f };
+                    auto positionsAccessor = bufferBuilder.AddAccessor(positions, { TYPE_VEC3, COMPONENT_FLOAT });
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    // The reader's own stream reader has no data, so the buffer can only be read via the random access reader
+                    GLTFResourceReader reader(std::make_shared<const StreamReaderWriter>());
+                    reader.SetRandomAccessReader(std::make_shared<StreamRandomAccessReader>(readerWriter));
+
+                    AreEqual(positions, reader.ReadBinaryData<float>(doc, positionsAccessor));
+
+                    reader.SetRandomAccessReader(nullptr);
+
+                    Assert::ExpectException<std::runtime_error>([&]()
+                    {
+                        reader.ReadBinaryData<float>(doc, positionsAccessor);
+                    });
+                }
+            };
+        }
+    }
+}
@@ -0,0 +1,297 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/Document.h>
+#include <GLTFSDK/ReadPlan.h>
+
+#include <string>
+#include <vector>
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    using namespace Microsoft::glTF;
+
+    Document CreateDocument()
+    {
+        Document doc;
+
+        Buffer buffer0;
+        buffer0.id = "0";
+        buffer0.byteLength = 1024U;
+        doc.buffers.Append(std::move(buffer0));
+
+        Buffer buffer1;
+        buffer1.id = "1";
+        buffer1.byteLength = 1024U;
+        doc.buffers.Append(std::move(buffer1));
+
+        // Interleaved vertex data
+        BufferView bufferView0;
+        bufferView0.id = "0";
+        bufferView0.bufferId = "0";
+        bufferView0.byteOffset = 0U;
+        bufferView0.byteLength = 96U;
+        bufferView0.byteStride = 24U;
+        doc.bufferViews.Append(std::move(bufferView0));
+
+        // Indices, immediately following the vertex data
+        BufferView bufferView1;
+        bufferView1.id = "1";
+        bufferView1.bufferId = "0";
+        bufferView1.byteOffset = 96U;
+        bufferView1.byteLength = 12U;
+        doc.bufferViews.Append(std::move(bufferView1));
+
+        // Sparse indices and values in a second buffer
+        BufferView bufferView2;
+        bufferView2.id = "2";
+        bufferView2.bufferId = "1";
+        bufferView2.byteOffset = 16U;
+        bufferView2.byteLength = 32U;
+        doc.bufferViews.Append(std::move(bufferView2));
+
+        Accessor positions;
+        positions.id = "0";
+        positions.bufferViewId = "0";
+        positions.componentType = COMPONENT_FLOAT;
+        positions.type = TYPE_VEC3;
+        positions.count = 4U;
+        doc.accessors.Append(std::move(positions));
+
+        Accessor normals;
+        normals.id = "1";
+        normals.bufferViewId = "0";
+        normals.byteOffset = 12U;
+        normals.componentType = COMPONENT_FLOAT;
+        normals.type = TYPE_VEC3;
+        normals.count = 4U;
+        doc.accessors.Append(std::move(normals));
+
+        Accessor indices;
+        indices.id = "2";
+        indices.bufferViewId = "1";
+        indices.componentType = COMPONENT_UNSIGNED_SHORT;
+        indices.type = TYPE_SCALAR;
+        indices.count = 6U;
+        doc.accessors.Append(std::move(indices));
+
+        Accessor morphPositions;
+        morphPositions.id = "3";
+        morphPositions.componentType = COMPONENT_FLOAT;
+        morphPositions.type = TYPE_VEC3;
+        morphPositions.count = 4U;
+        morphPositions.sparse.count = 2U;
+        morphPositions.sparse.indicesBufferViewId = "2";
+        morphPositions.sparse.indicesComponentType = COMPONENT_UNSIGNED_BYTE;
+        morphPositions.sparse.valuesBufferViewId = "2";
+        morphPositions.sparse.valuesByteOffset = 8U;
+        doc.accessors.Append(std::move(morphPositions));
+
+        return doc;
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(ReadPlanTests)
+            {
+                GLTFSDK_TEST_METHOD(ReadPlanTests, ReadPlan_MergesAdjacentAndOverlappingRanges)
+                {
+                    ReadPlan plan;
+
+                    Assert::IsTrue(plan.IsEmpty());
+
+                    plan.AddBufferRange("0", 100U, 50U);
+                    plan.AddBufferRange("0", 0U, 20U);
+                    plan.AddBufferRange("0", 20U, 30U);  // Adjacent to [0, 20)
+                    plan.AddBufferRange("0", 120U, 10U); // Within [100, 150)
+                    plan.AddBufferRange("0", 140U, 20U); // Overlaps [100, 150)
+                    plan.AddBufferRange("1", 50U, 10U);  // Adjacent, but in a different buffer
+                    plan.AddBufferRange("1", 70U, 0U);   // Empty ranges are ignored
+
+                    Assert::IsFalse(plan.IsEmpty());
+
+                    const std::vector<BufferRange> expected = {
+                        { "0", 0U, 50U },
+                        { "0", 100U, 60U },
+                        { "1", 50U, 10U }
+                    };
+
+                    Assert::IsTrue(expected == plan.GetBufferRanges());
+                }
+
+                GLTFSDK_TEST_METHOD(ReadPlanTests, ReadPlan_MergesRangesWithinMaxGap)
+                {
+                    ReadPlan plan(16U);
+
+                    plan.AddBufferRange("0", 0U, 16U);
+                    plan.AddBufferRange("0", 32U, 16U);  // 16 byte gap
+                    plan.AddBufferRange("0", 100U, 16U); // 52 byte gap
+
+                    const std::vector<BufferRange> expected = {
+                        { "0", 0U, 48U },
+                        { "0", 100U, 16U }
+                    };
+
+                    Assert::IsTrue(expected == plan.GetBufferRanges());
+                }
+
+                GLTFSDK_TEST_METHOD(ReadPlanTests, ReadPlan_AddAccessor_Interleaved)
+                {
+                    const auto doc = CreateDocument();
+
+                    ReadPlan plan;
+                    plan.AddAccessor(doc, doc.accessors.Get("1"));
+
+                    // The last element ends 12 bytes after it begins, not a whole stride
+                    const std::vector<BufferRange> expected = {
+                        { "0", 12U, 84U }
+                    };
+
+                    Assert::IsTrue(expected == plan.GetBufferRanges());
+                }
+
+                GLTFSDK_TEST_METHOD(ReadPlanTests, ReadPlan_AddAccessor_Sparse)
+                {
+                    const auto doc = CreateDocument();
+
+                    ReadPlan plan;
+                    plan.AddAccessor(doc, doc.accessors.Get("3"));
+
+                    const std::vector<BufferRange> expected = {
+                        { "1", 16U, 2U },
+                        { "1", 24U, 24U }
+                    };
+
+                    Assert::IsTrue(expected == plan.GetBufferRanges());
+                }
+
+                GLTFSDK_TEST_METHOD(ReadPlanTests, ReadPlan_AddMeshPrimitive)
+                {
+                    const auto doc = CreateDocument();
+
+                    MeshPrimitive meshPrimitive;
+                    meshPrimitive.attributes[ACCESSOR_POSITION] = "0";
+                    meshPrimitive.attributes[ACCESSOR_NORMAL] = "1";
+                    meshPrimitive.indicesAccessorId = "2";
+
+                    MorphTarget morphTarget;
+                    morphTarget.positionsAccessorId = "3";
+                    meshPrimitive.targets.push_back(morphTarget);
+
+                    Mesh mesh;
+                    mesh.primitives.push_back(meshPrimitive);
+
+                    ReadPlan plan(8U);
+                    plan.AddMesh(doc, mesh);
+
+                    // The vertex and index data are read with a single read, as are the sparse indices and values
+                    const std::vector<BufferRange> expected = {
+                        { "0", 0U, 108U },
+                        { "1", 16U, 32U }
+                    };
+
+                    Assert::IsTrue(expected == plan.GetBufferRanges());
+                }
+
+                GLTFSDK_TEST_METHOD(ReadPlanTests, ReadPlan_AddScene)
+                {
+                    auto doc = CreateDocument();
+
+                    // Image data, stored in the second buffer
+                    BufferView bufferView3;
+                    bufferView3.id = "3";
+                    bufferView3.bufferId = "1";
+                    bufferView3.byteOffset = 512U;
+                    bufferView3.byteLength = 256U;
+                    doc.bufferViews.Append(std::move(bufferView3));
+
+                    Image image0;
+                    image0.id = "0";
+                    image0.uri = "image.png";
+                    doc.images.Append(std::move(image0));
+
+                    Image image1;
+                    image1.id = "1";
+                    image1.bufferViewId = "3";
+                    doc.images.Append(std::move(image1));
+
+                    Image image2;
+                    image2.id = "2";
+                    image2.uri = "data:image/png;base64,AAAA";
+                    doc.images.Append(std::move(image2));
+
+                    for (const auto& image : doc.images.Elements())
+                    {
+                        Texture texture;
+                        texture.id = image.id;
+                        texture.imageId = image.id;
+                        doc.textures.Append(std::move(texture));
+                    }
+
+                    Material material;
+                    material.id = "0";
+                    material.metallicRoughness.baseColorTexture.textureId = "0";
+                    material.normalTexture.textureId = "1";
+                    material.occlusionTexture.textureId = "2";
+                    doc.materials.Append(std::move(material));
+
+                    MeshPrimitive meshPrimitive;
+                    meshPrimitive.attributes[ACCESSOR_POSITION] = "0";
+                    meshPrimitive.indicesAccessorId = "2";
+                    meshPrimitive.materialId = "0";
+
+                    Mesh mesh;
+                    mesh.id = "0";
+                    mesh.primitives.push_back(meshPrimitive);
+                    doc.meshes.Append(std::move(mesh));
+
+                    Skin skin;
+                    skin.id = "0";
+                    skin.inverseBindMatricesAccessorId = "3";
+                    doc.skins.Append(std::move(skin));
+
+                    // Two nodes share the mesh, it should only be planned once
+                    Node node0;
+                    node0.id = "0";
+                    node0.meshId = "0";
+                    node0.children = { "1" };
+                    doc.nodes.Append(std::move(node0));
+
+                    Node node1;
+                    node1.id = "1";
+                    node1.meshId = "0";
+                    node1.skinId = "0";
+                    doc.nodes.Append(std::move(node1));
+
+                    Scene scene;
+                    scene.id = "0";
+                    scene.nodes = { "0" };
+                    doc.SetDefaultScene(std::move(scene));
+
+                    ReadPlan plan;
+                    plan.AddScene(doc);
+
+                    const std::vector<BufferRange> expected = {
+                        { "0", 0U, 84U },
+                        { "0", 96U, 12U },
+                        { "1", 16U, 2U },
+                        { "1", 24U, 24U },
+                        { "1", 512U, 256U }
+                    };
+
+                    Assert::IsTrue(expected == plan.GetBufferRanges());
+                    Assert::IsTrue(std::vector<std::string>{ "image.png" } == plan.GetImageUris());
+                }
+            };
+        }
+    }
+}
@@ -9,11 +9,171 @@
 
 #include "TestUtils.h"
 
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
 #include <memory>
 #include <string>
 
 using namespace glTF::UnitTest;
 
+namespace
+{
+    std::string Base64Encode(const std::vector<uint8_t>& data)
+    {
+        using Microsoft::glTF::characterSet;
+
+        std::string encoded;
+
+        for (size_t i = 0; i < data.size(); i += 3U)
+        {
+            const size_t byteCount = std::min<size_t>(3U, data.size() - i);
+
+            uint32_t block = data[i] << 16;
+
+            if (byteCount > 1U) block |= data[i + 1U] << 8;
+            if (byteCount > 2U) block |= data[i + 2U];
+
+            encoded += characterSet[(block >> 18) & 0x3F];
+            encoded += characterSet[(block >> 12) & 0x3F];
+            encoded += byteCount > 1U ? characterSet[(block >> 6) & 0x3F] : '=';
+            encoded += byteCount > 2U ? characterSet[block & 0x3F] : '=';
+        }
+
+        return encoded;
+    }
+
+    std::vector<uint8_t> MakeRandomData(size_t byteCount, unsigned int seed)
+    {
+        std::vector<uint8_t> data(byteCount);
+
+        std::srand(seed);
+        std::generate(data.begin(), data.end(), []() { return static_cast<uint8_t>(std::rand()); });
+
+        return data;
+    }
+
+    // Compares ComponentsToFloats against ComponentToFloat for every value of T. The values are converted at a
+    // range of offsets and lengths so that both the vectorized loop and the scalar tail are exercised.
+    template<typename T>
+    void TestComponentsToFloats()
+    {
+        using namespace Microsoft::glTF;
+
+        std::vector<T> components;
+
+        for (int64_t i = std::numeric_limits<T>::min(); i <= std::numeric_limits<T>::max(); ++i)
+        {
+            components.push_back(static_cast<T>(i));
+        }
+
+        std::vector<float> floats(components.size());
+
+        for (size_t offset = 0U; offset < 3U; ++offset)
+        {
+            const size_t count = components.size() - offset * 5U;
+
+            ComponentsToFloats(components.data() + offset, count, floats.data());
+
+            for (size_t i = 0U; i < count; ++i)
+            {
+                Assert::AreEqual(ComponentToFloat(components[offset + i]), floats[i]);
+            }
+        }
+    }
+
+    // Compares FloatsToComponents against FloatToComponent for floats spanning T's normalized range (including
+    // those halfway between two components) and checks that out-of-range floats are clamped
+    template<typename T>
+    void TestFloatsToComponents(float floatMin)
+    {
+        using namespace Microsoft::glTF;
+
+        const float scale = static_cast<float>(std::numeric_limits<T>::max());
+
+        std::vector<float> floats;
+
+        for (int64_t i = static_cast<int64_t>(floatMin * scale); i <= static_cast<int64_t>(scale); ++i)
+        {
+            floats.push_back(i / scale);
+            floats.push_back((i + 0.5f) / scale);
+            floats.push_back((i + 0.25f) / scale);
+        }
+
+        // Odd length, so the scalar tail is exercised
+        floats.push_back(0.5f);
+
+        std::vector<T> components(floats.size());
+
+        FloatsToComponents(floats.data(), floats.size(), components.data());
+
+        for (size_t i = 0U; i < floats.size(); ++i)
+        {
+            const float f = std::min(std::max(floats[i], floatMin), 1.0f);
+            Assert::AreEqual(FloatToComponent<T>(f), components[i]);
+        }
+
+        const std::vector<float> outOfRange(17U, 2.0f);
+        FloatsToComponents(outOfRange.data(), outOfRange.size(), components.data());
+        Assert::IsTrue(std::all_of(components.begin(), components.begin() + outOfRange.size(), [](T c) { return c == std::numeric_limits<T>::max(); }));
+
+        const std::vector<float> outOfRangeNegative(17U, -2.0f);
+        FloatsToComponents(outOfRangeNegative.data(), outOfRangeNegative.size(), components.data());
+        Assert::IsTrue(std::all_of(components.begin(), components.begin() + outOfRangeNegative.size(), [floatMin](T c) { return c == FloatToComponent<T>(floatMin); }));
+    }
+
+    // Times the batch conversions against per component calls of ComponentToFloat and FloatToComponent (clamping
+    // each float as FloatsToComponents does) over 10M components
+    template<typename T>
+    void BenchmarkComponentConversions(const char* typeName, float floatMin)
+    {
+        using namespace Microsoft::glTF;
+        using Microsoft::glTF::Test::MeasureMilliseconds;
+
+        const size_t count = 10000000U;
+
+        std::vector<T> components(count);
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+            components[i] = static_cast<T>(i);
+        }
+
+        std::vector<float> floats(count);
+        std::vector<float> floatsBatch(count);
+
+        const double toFloatMilliseconds = MeasureMilliseconds([&]()
+        {
+            std::transform(components.begin(), components.end(), floats.begin(), [](T c) { return ComponentToFloat(c); });
+        });
+
+        const double toFloatBatchMilliseconds = MeasureMilliseconds([&]()
+        {
+            ComponentsToFloats(components.data(), count, floatsBatch.data());
+        });
+
+        Assert::IsTrue(floats == floatsBatch);
+
+        std::vector<T> componentsBatch(count);
+
+        const double toComponentMilliseconds = MeasureMilliseconds([&]()
+        {
+            std::transform(floats.begin(), floats.end(), components.begin(), [floatMin](float f) { return FloatToComponent<T>(std::min(std::max(f, floatMin), 1.0f)); });
+        });
+
+        const double toComponentBatchMilliseconds = MeasureMilliseconds([&]()
+        {
+            FloatsToComponents(floats.data(), count, componentsBatch.data());
+        });
+
+        Assert::IsTrue(components == componentsBatch);
+
+        std::cout << typeName << ": ComponentToFloat " << toFloatMilliseconds << "ms, ComponentsToFloats " << toFloatBatchMilliseconds << "ms, "
+            "FloatToComponent " << toComponentMilliseconds << "ms, FloatsToComponents " << toComponentBatchMilliseconds << "ms" << std::endl;
+    }
+}
+
 namespace Microsoft
 {
     namespace glTF
@@ -90,6 +250,91 @@ namespace Microsoft
                     }
                 }
 
+                GLTFSDK_TEST_METHOD(ResourceReaderUtilsTest, TestValidBase64UriRandom)
+                {
+                    // Long enough that the majority of the characters are decoded by any vectorized implementation
+                    for (size_t byteCount = 0U; byteCount <= 200U; ++byteCount)
+                    {
+                        const auto expected = MakeRandomData(byteCount, static_cast<unsigned int>(byteCount));
+                        const auto encoded = Base64Encode(expected);
+
+                        Assert::IsTrue(expected == Base64Decode(encoded), L"Decoded data doesn't match expected values");
+
+                        for (size_t bytesToSkip = 0U; bytesToSkip <= byteCount; ++bytesToSkip)
+                        {
+                            std::vector<uint8_t> actual(byteCount - bytesToSkip);
+                            Base64Decode(Base64StringView(encoded), Base64BufferView(actual), bytesToSkip);
+
+                            Assert::IsTrue(std::equal(actual.begin(), actual.end(), expected.begin() + bytesToSkip), L"Decoded data doesn't match expected values");
+                        }
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(ResourceReaderUtilsTest, TestInvalidBase64UriRandom)
+                {
+                    const auto encoded = Base64Encode(MakeRandomData(99U, 0U));
+
+                    for (size_t i = 0U; i < encoded.size(); ++i)
+                    {
+                        for (const char invalidChar : { '\t', '-', '_', '.', '\x80', '\xFF' })
+                        {
+                            auto invalid = encoded;
+                            invalid[i] = invalidChar;
+
+                            Assert::ExpectException<GLTFException>([&invalid]()
+                            {
+                                Base64Decode(invalid);
+                            });
+                        }
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(ResourceReaderUtilsTest, TestBase64UriDecodeOnce)
+                {
+                    const auto expected = MakeRandomData(100U, 0U);
+
+                    Buffer buffer;
+                    buffer.id = "buffer";
+                    buffer.uri = "data:application/octet-stream;base64," + Base64Encode(expected);
+                    buffer.byteLength = expected.size();
+
+                    Document gltfDocument;
+                    gltfDocument.buffers.Append(buffer);
+
+                    GLTFResourceReader gltfResourceReader(std::make_shared<StreamReaderWriter>());
+                    gltfResourceReader.SetDecodeDataUrisOnce(true);
+
+                    Assert::IsTrue(gltfResourceReader.GetDecodeDataUrisOnce());
+
+                    for (size_t i = 0; i < expected.size(); i += 7U)
+                    {
+                        for (size_t j = i + 1U; j <= expected.size(); j += 5U)
+                        {
+                            BufferView bufferView;
+
+                            bufferView.bufferId = buffer.id;
+                            bufferView.byteOffset = i;
+                            bufferView.byteLength = j - i;
+
+                            auto resultExpected = std::vector<uint8_t>(expected.begin() + i, expected.begin() + j);
+                            auto resultActual = gltfResourceReader.ReadBinaryData<uint8_t>(gltfDocument, bufferView);
+
+                            Assert::IsTrue(resultExpected == resultActual, L"Decoded data uri range doesn't match expected values");
+                        }
+                    }
+
+                    // The decoded data is released, and decoded again when next read
+                    gltfResourceReader.ClearPrefetched();
+
+                    BufferView bufferView;
+
+                    bufferView.bufferId = buffer.id;
+                    bufferView.byteOffset = 0U;
+                    bufferView.byteLength = expected.size();
+
+                    Assert::IsTrue(expected == gltfResourceReader.ReadBinaryData<uint8_t>(gltfDocument, bufferView), L"Decoded data uri doesn't match expected values");
+                }
+
                 GLTFSDK_TEST_METHOD(ResourceReaderUtilsTest, TestValidBase64UriFinal2Chars)
                 {
                     const auto data = Base64Decode("YW55IGNhcm5hbCBwbGVhcw");
@@ -320,6 +565,30 @@ namespace Microsoft
                     }
                 }
 
+                GLTFSDK_TEST_METHOD(ResourceReaderUtilsTest, TestComponentsToFloats)
+                {
+                    TestComponentsToFloats<int8_t>();
+                    TestComponentsToFloats<uint8_t>();
+                    TestComponentsToFloats<int16_t>();
+                    TestComponentsToFloats<uint16_t>();
+                }
+
+                GLTFSDK_TEST_METHOD(ResourceReaderUtilsTest, TestFloatsToComponents)
+                {
+                    TestFloatsToComponents<int8_t>(-1.0f);
+                    TestFloatsToComponents<uint8_t>(0.0f);
+                    TestFloatsToComponents<int16_t>(-1.0f);
+                    TestFloatsToComponents<uint16_t>(0.0f);
+                }
+
+                GLTFSDK_BENCHMARK_METHOD(ResourceReaderUtilsTest, BenchmarkComponentConversions)
+                {
+                    BenchmarkComponentConversions<int8_t>("int8_t", -1.0f);
+                    BenchmarkComponentConversions<uint8_t>("uint8_t", 0.0f);
+                    BenchmarkComponentConversions<int16_t>("int16_t", -1.0f);
+                    BenchmarkComponentConversions<uint16_t>("uint16_t", 0.0f);
+                }
+
                 GLTFSDK_TEST_METHOD(ResourceReaderUtilsTest, TestIsUriBase64)
                 {
                     std::string::const_iterator itBegin;
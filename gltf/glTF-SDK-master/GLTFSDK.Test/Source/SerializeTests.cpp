@@ -4,8 +4,12 @@
 #include "stdafx.h"
 
 #include <GLTFSDK/GLTF.h>
+#include <GLTFSDK/JsonArena.h>
 #include <GLTFSDK/Serialize.h>
 #include <GLTFSDK/Deserialize.h>
+#include <GLTFSDK/ExtensionHandlers.h>
+
+#include <sstream>
 
 using namespace glTF::UnitTest;
 
@@ -234,6 +238,56 @@ namespace Microsoft
                         }
                     }, L"Expected exception was not thrown");
                 }
+
+                GLTFSDK_TEST_METHOD(SerializeTests, SerializeWithArena)
+                {
+                    Document doc;
+                    Scene scene;
+                    scene.id = "foo";
+                    doc.SetDefaultScene(std::move(scene));
+
+                    JsonArena arena;
+
+                    // The arena's string buffer is reused, output must never include a previous document's json
+                    Assert::AreEqual(Serialize(doc, arena, SerializeFlags::Pretty).c_str(), c_expectedDefaultDocumentAndNonDefaultSceneAsDefault);
+                    Assert::AreEqual(Serialize(Document(), arena, SerializeFlags::Pretty).c_str(), c_expectedDefaultDocument);
+                    Assert::AreEqual(Serialize(doc, arena).c_str(), Serialize(doc).c_str());
+                }
+
+                GLTFSDK_TEST_METHOD(SerializeTests, SerializeToStream)
+                {
+                    Document doc;
+                    Scene scene;
+                    scene.id = "foo";
+                    doc.SetDefaultScene(std::move(scene));
+
+                    Node node;
+                    node.id = "node";
+                    node.extras = R"({"bar": 1})";
+                    node.extensions.emplace("EXT_foo", R"({"baz": [1, 2]})");
+                    doc.nodes.Append(std::move(node));
+                    doc.nodes.Append(Node());
+
+                    doc.extensionsUsed.insert("EXT_foo");
+                    doc.extensions.emplace("EXT_foo", "{}");
+
+                    // Streamed output must be identical to the json built via a DOM
+                    for (auto flags : { SerializeFlags::None, SerializeFlags::Pretty })
+                    {
+                        const auto expected = Serialize(doc, flags);
+
+                        std::stringstream stream;
+                        Serialize(doc, stream, flags);
+
+                        Assert::AreEqual(expected.c_str(), stream.str().c_str());
+                        Assert::AreEqual(expected.length(), GetSerializedLength(doc, ExtensionSerializer(), flags));
+                    }
+
+                    std::stringstream stream;
+                    Serialize(Document(), stream, SerializeFlags::Pretty);
+
+                    Assert::AreEqual(c_expectedDefaultDocument, stream.str().c_str());
+                }
             };
         }
     }
@@ -0,0 +1,142 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/BufferBuilder.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/GLTFResourceWriter.h>
+#include <GLTFSDK/SparseAccessorView.h>
+
+#include "TestUtils.h"
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    using namespace Microsoft::glTF;
+
+    // Adds a copy of the accessor to the document with the specified buffer views' sparse indices and values.
+    // The sparse accessor's base data is the accessor's data (or zeros if the accessor has no bufferView).
+    Accessor AddSparseAccessor(Document& doc, Accessor accessor, const BufferView& indicesBufferView, const BufferView& valuesBufferView, size_t sparseCount)
+    {
+        accessor.id = std::to_string(doc.accessors.Size());
+        accessor.sparse.count = sparseCount;
+        accessor.sparse.indicesBufferViewId = indicesBufferView.id;
+        accessor.sparse.indicesComponentType = COMPONENT_UNSIGNED_SHORT;
+        accessor.sparse.valuesBufferViewId = valuesBufferView.id;
+
+        return doc.accessors.Append(std::move(accessor));
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(SparseAccessorViewTests)
+            {
+                GLTFSDK_TEST_METHOD(SparseAccessorViewTests, SparseAccessorView_Overlay)
+                {
+                    AccessorView<float> baseView(std::vector<float>{ 0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f }, 2U);
+
+                    // Unsorted indices are sorted along with their values
+                    SparseAccessorView<float> view(baseView, true, 4U, 2U, { 3U, 1U }, { 30.0f, 31.0f, 10.0f, 11.0f });
+
+                    Assert::AreEqual<size_t>(4U, view.GetElementCount());
+                    Assert::AreEqual<size_t>(2U, view.GetSparseCount());
+                    Assert::IsTrue(view.GetSparseIndices() == std::vector<uint32_t>{ 1U, 3U });
+                    AreEqual(std::vector<float>{ 10.0f, 11.0f, 30.0f, 31.0f }, view.GetSparseValues());
+
+                    Assert::IsTrue(view.FindSparseElement(0U) == nullptr);
+                    Assert::AreEqual(31.0f, view.FindSparseElement(3U)[1]);
+
+                    Assert::AreEqual(10.0f, view.Get(1U, 0U));
+                    Assert::AreEqual(4.0f, view.Get(2U, 0U));
+
+                    float element[2];
+                    view.GetElement(0U, element);
+                    Assert::AreEqual(1.0f, element[1]);
+
+                    AreEqual(std::vector<float>{ 0.0f, 1.0f, 10.0f, 11.0f, 4.0f, 5.0f, 30.0f, 31.0f }, view.ToVector());
+                }
+
+                GLTFSDK_TEST_METHOD(SparseAccessorViewTests, SparseAccessorView_NoBaseView)
+                {
+                    SparseAccessorView<uint16_t> view({}, false, 5U, 1U, { 0U, 4U, 4U }, { 7U, 8U, 9U });
+
+                    Assert::IsFalse(view.HasBaseView());
+                    Assert::AreEqual<uint16_t>(0U, view.Get(2U, 0U));
+
+                    // The last value of a repeated index is used
+                    Assert::AreEqual<uint16_t>(9U, view.Get(4U, 0U));
+                    AreEqual(std::vector<uint16_t>{ 7U, 0U, 0U, 0U, 9U }, view.ToVector());
+                }
+
+                GLTFSDK_TEST_METHOD(SparseAccessorViewTests, SparseAccessorView_InvalidIndex)
+                {
+                    Assert::ExpectException<GLTFException>([]()
+                    {
+                        SparseAccessorView<uint8_t> view({}, false, 2U, 1U, { 2U }, { 1U });
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(SparseAccessorViewTests, ReadSparseAccessorView)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    std::vector<float> positions(3U * 100U);
+
+                    for (size_t i = 0U; i < positions.size(); ++i)
+                    {
+                        positions[i] = static_cast<float>(i);
+                    }
+
+                    auto baseAccessor = bufferBuilder.AddAccessor(positions, { TYPE_VEC3, COMPONENT_FLOAT });
+
+                    // The values are added first so that both buffer views are aligned to their component sizes
+                    auto valuesBufferView = bufferBuilder.AddBufferView(std::vector<float>{ -1.0f, -2.0f, -3.0f, -4.0f, -5.0f, -6.0f, -7.0f, -8.0f, -9.0f });
+                    auto indicesBufferView = bufferBuilder.AddBufferView(std::vector<uint16_t>{ 5U, 50U, 99U });
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    auto sparseAccessor = AddSparseAccessor(doc, baseAccessor, indicesBufferView, valuesBufferView, 3U);
+
+                    Accessor zeroAccessor = baseAccessor;
+                    zeroAccessor.bufferViewId.clear();
+                    zeroAccessor.byteOffset = 0U;
+                    zeroAccessor = AddSparseAccessor(doc, zeroAccessor, indicesBufferView, valuesBufferView, 3U);
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    auto view = reader.ReadSparseAccessorView<float>(doc, sparseAccessor);
+
+                    Assert::IsTrue(view.HasBaseView());
+                    Assert::AreEqual<size_t>(3U, view.GetSparseCount());
+                    Assert::AreEqual(-4.0f, view.Get(50U, 0U));
+                    Assert::AreEqual(153.0f, view.Get(51U, 0U));
+                    AreEqual(reader.ReadBinaryData<float>(doc, sparseAccessor), view.ToVector());
+
+                    auto zeroView = reader.ReadSparseAccessorView<float>(doc, zeroAccessor);
+
+                    Assert::IsFalse(zeroView.HasBaseView());
+                    Assert::AreEqual(0.0f, zeroView.Get(0U, 0U));
+                    AreEqual(reader.ReadBinaryData<float>(doc, zeroAccessor), zeroView.ToVector());
+
+                    // Accessors without sparse values are viewed as an overlay without any sparse values
+                    auto denseView = reader.ReadSparseAccessorView<float>(doc, baseAccessor);
+
+                    Assert::AreEqual<size_t>(0U, denseView.GetSparseCount());
+                    AreEqual(positions, denseView.ToVector());
+                }
+            };
+        }
+    }
+}
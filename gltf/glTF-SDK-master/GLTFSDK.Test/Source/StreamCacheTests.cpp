@@ -4,6 +4,16 @@
 #include "stdafx.h"
 
 #include <GLTFSDK/StreamCacheLRU.h>
+#include <GLTFSDK/StreamCacheShardedLRU.h>
+
+#include "TestUtils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <thread>
 
 using namespace glTF::UnitTest;
 
@@ -214,6 +224,215 @@ namespace Microsoft
                         Assert::IsTrue(ss1Cached->str().empty());
                     }
                 }
+
+                GLTFSDK_TEST_METHOD(StreamCacheTest, StreamReaderCacheShardedLRUGetSet)
+                {
+                    auto streamReader = std::make_shared<TestStreamReader>();
+                    auto streamCache = MakeStreamReaderCache<StreamReaderCacheShardedLRU>(streamReader);
+
+                    auto stream1 = streamCache->Get("1");
+                    auto stream2 = streamCache->Get("1");
+
+                    Assert::IsTrue(stream1 == stream2);
+                    Assert::AreEqual(size_t(1), streamReader->m_counts["1"]);
+
+                    auto ss = std::make_shared<std::stringstream>("Cherry");
+                    streamCache->Set("2", ss);
+
+                    Assert::IsTrue(streamCache->Get("2") == ss);
+                    Assert::AreEqual(size_t(2), streamCache->Size());
+                    Assert::AreEqual(size_t(0), streamReader->m_counts.count("2"));
+                }
+
+                GLTFSDK_TEST_METHOD(StreamCacheTest, StreamReaderCacheShardedLRUSetMaxSize0)
+                {
+                    Assert::ExpectException<GLTFException>([]()
+                    {
+                        auto streamReader = std::make_shared<TestStreamReader>();
+                        auto streamCache = MakeStreamReaderCache<StreamReaderCacheShardedLRU>(streamReader, 0U);
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(StreamCacheTest, StreamReaderCacheShardedLRUMaxSize)
+                {
+                    auto streamReader = std::make_shared<TestStreamReader>();
+                    auto streamCache = MakeStreamReaderCache<StreamReaderCacheShardedLRU>(streamReader, 4U, 16U);
+
+                    // The shard count is limited by the max cache size
+                    Assert::AreEqual(size_t(4), streamCache->GetShardCount());
+
+                    for (size_t i = 0U; i < 100U; ++i)
+                    {
+                        streamCache->Get(std::to_string(i));
+                        Assert::IsTrue(streamCache->Size() <= 4U);
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(StreamCacheTest, StreamReaderCacheShardedLRUDefaultShardCount)
+                {
+                    auto streamReader = std::make_shared<TestStreamReader>();
+
+                    // Each shard holds at least four streams so, e.g., the default 16 stream reader cache isn't split
+                    // into 16 single stream shards
+                    Assert::AreEqual(size_t(4), MakeStreamReaderCache<StreamReaderCacheShardedLRU>(streamReader, 16U)->GetShardCount());
+                    Assert::AreEqual(size_t(1), MakeStreamReaderCache<StreamReaderCacheShardedLRU>(streamReader, 2U)->GetShardCount());
+                    Assert::AreEqual(size_t(16), MakeStreamReaderCache<StreamReaderCacheShardedLRU>(streamReader, 1024U)->GetShardCount());
+                    Assert::AreEqual(size_t(16), MakeStreamReaderCache<StreamReaderCacheShardedLRU>(streamReader)->GetShardCount());
+
+                    auto streamCache = MakeStreamReaderCache<StreamReaderCacheShardedLRU>(streamReader, 16U);
+
+                    std::vector<std::shared_ptr<std::istream>> streams;
+
+                    for (size_t i = 0U; i < 4U; ++i)
+                    {
+                        streams.push_back(streamCache->Get(std::to_string(i)));
+                    }
+
+                    // Four uris fit in any shard, however they hash, so none has been evicted
+                    for (size_t i = 0U; i < 4U; ++i)
+                    {
+                        Assert::IsTrue(streamCache->Get(std::to_string(i)) == streams[i]);
+                    }
+
+                    Assert::AreEqual(size_t(4), streamReader->m_counts.size());
+                }
+
+                GLTFSDK_TEST_METHOD(StreamCacheTest, StreamReaderCacheShardedLRUMaxSizeRemainder)
+                {
+                    auto streamReader = std::make_shared<TestStreamReader>();
+                    auto streamCache = MakeStreamReaderCache<StreamReaderCacheShardedLRU>(streamReader, 10U, 4U);
+
+                    Assert::AreEqual(size_t(4), streamCache->GetShardCount());
+
+                    // The max cache size isn't a multiple of the shard count, the total must still not exceed it
+                    for (size_t i = 0U; i < 1000U; ++i)
+                    {
+                        streamCache->Get(std::to_string(i));
+                        Assert::IsTrue(streamCache->Size() <= 10U);
+                    }
+
+                    Assert::AreEqual(size_t(10), streamCache->Size());
+                }
+
+                GLTFSDK_TEST_METHOD(StreamCacheTest, StreamReaderCacheShardedLRUSingleShard)
+                {
+                    auto streamReader = std::make_shared<TestStreamReader>();
+                    auto streamCache = MakeStreamReaderCache<StreamReaderCacheShardedLRU>(streamReader, 2U, 1U);
+
+                    auto ss1 = std::make_shared<std::stringstream>("Apple");
+                    auto ss2 = std::make_shared<std::stringstream>("Orange");
+                    auto ss3 = std::make_shared<std::stringstream>("Pear");
+
+                    streamCache->Set("1", ss1);
+                    streamCache->Set("2", ss2);
+                    streamCache->Set("3", ss3);
+
+                    // With a single shard eviction is exactly LRU - the 'Apple' stream should have been evicted
+                    Assert::IsTrue(streamCache->Get("3") == ss3);
+                    Assert::IsTrue(streamCache->Get("2") == ss2);
+                    Assert::IsTrue(streamCache->Get("1") != ss1);
+                }
+
+                GLTFSDK_TEST_METHOD(StreamCacheTest, StreamReaderCacheShardedLRUConcurrentGet)
+                {
+                    std::atomic<size_t> generateCount(0U);
+
+                    StreamReaderCacheShardedLRU streamCache([&generateCount](const std::string&)
+                    {
+                        ++generateCount;
+                        return std::make_shared<std::stringstream>();
+                    }, 1024U, 8U);
+
+                    std::vector<std::thread> threads;
+
+                    for (size_t i = 0U; i < 8U; ++i)
+                    {
+                        threads.emplace_back([&streamCache]()
+                        {
+                            for (size_t j = 0U; j < 1000U; ++j)
+                            {
+                                streamCache.Get(std::to_string(j % 32U));
+                            }
+                        });
+                    }
+
+                    for (auto& thread : threads)
+                    {
+                        thread.join();
+                    }
+
+                    // Every uri fits in the cache so each stream is only generated once
+                    Assert::AreEqual(size_t(32), generateCount.load());
+                    Assert::AreEqual(size_t(32), streamCache.Size());
+                }
+
+                GLTFSDK_BENCHMARK_METHOD(StreamCacheTest, BenchmarkStreamReaderCacheShardedLRUContention)
+                {
+                    const auto generate = [](const std::string&)
+                    {
+                        return std::make_shared<std::stringstream>();
+                    };
+
+                    // Each thread gets 128 uris from a cache of 64 streams, so roughly half are misses that evict
+                    const auto runThreads = [](size_t threadCount, const std::function<void(const std::string&)>& get)
+                    {
+                        std::vector<std::string> uris;
+
+                        for (size_t i = 0U; i < 128U; ++i)
+                        {
+                            uris.push_back(std::to_string(i));
+                        }
+
+                        std::vector<std::thread> threads;
+
+                        for (size_t i = 0U; i < threadCount; ++i)
+                        {
+                            threads.emplace_back([&uris, &get, i]()
+                            {
+                                for (size_t j = 0U; j < 100000U; ++j)
+                                {
+                                    get(uris[(i * 7U + j * 13U) % uris.size()]);
+                                }
+                            });
+                        }
+
+                        for (auto& thread : threads)
+                        {
+                            thread.join();
+                        }
+                    };
+
+                    const size_t maxThreadCount = std::min(32U, std::max(1U, std::thread::hardware_concurrency()));
+
+                    for (size_t threadCount = 1U; threadCount <= maxThreadCount; threadCount *= 2U)
+                    {
+                        // StreamReaderCacheLRU isn't thread safe so every Get must hold a single lock
+                        StreamReaderCacheLRU streamCacheLRU(generate, 64U);
+                        std::mutex mutex;
+
+                        const double lruMilliseconds = MeasureMilliseconds([&]()
+                        {
+                            runThreads(threadCount, [&](const std::string& uri)
+                            {
+                                std::lock_guard<std::mutex> lock(mutex);
+                                streamCacheLRU.Get(uri);
+                            });
+                        });
+
+                        StreamReaderCacheShardedLRU streamCacheShardedLRU(generate, 64U);
+
+                        const double shardedMilliseconds = MeasureMilliseconds([&]()
+                        {
+                            runThreads(threadCount, [&](const std::string& uri)
+                            {
+                                streamCacheShardedLRU.Get(uri);
+                            });
+                        });
+
+                        std::cout << threadCount << " threads: StreamReaderCacheLRU (locked) " << lruMilliseconds << "ms, "
+                            "StreamReaderCacheShardedLRU (" << streamCacheShardedLRU.GetShardCount() << " shards) " << shardedMilliseconds << "ms" << std::endl;
+                    }
+                }
             };
         }
     }
@@ -8,14 +8,31 @@
 #include <GLTFSDK/GLTFResourceWriter.h>
 #include <GLTFSDK/IStreamReader.h>
 #include <GLTFSDK/IStreamWriter.h>
+#include <GLTFSDK/MemoryStream.h>
 
+#include <chrono>
 #include <fstream>
+#include <iterator>
 #include <memory>
 #include <unordered_map>
 #include <sstream>
 
 using namespace glTF::UnitTest;
 
+// Benchmarks are disabled by default. With Google Test run them with: --gtest_also_run_disabled_tests --gtest_filter=*__BENCHMARK
+// With the VS test framework they are ignored, remove the TEST_IGNORE attribute locally to run them
+#if USE_GOOGLE_TEST
+#define GLTFSDK_BENCHMARK_METHOD(TESTNAME, METHOD) GLTFSDK_TEST_METHOD_FILTER(TESTNAME, DISABLED_ ## METHOD, BENCHMARK)
+#else
+#define GLTFSDK_BENCHMARK_METHOD(TESTNAME, METHOD) \
+    BEGIN_TEST_METHOD_ATTRIBUTE(METHOD) \
+        TEST_OWNER (L"BENCHMARK") \
+        TEST_METHOD_ATTRIBUTE (L"Filter", L"BENCHMARK") \
+        TEST_IGNORE() \
+    END_TEST_METHOD_ATTRIBUTE() \
+    GLTFSDK_TEST_METHOD_INTERNAL(TESTNAME, METHOD)
+#endif
+
 namespace Microsoft
 {
     namespace glTF
@@ -58,6 +75,50 @@ namespace Microsoft
                 mutable std::unordered_map<std::string, std::shared_ptr<std::stringstream>> m_streams;
             };
 
+            // Returns MemoryStreams over a snapshot of the data previously written to a StreamReaderWriter
+            class MemoryStreamReader : public Microsoft::glTF::IStreamReader
+            {
+            public:
+                MemoryStreamReader(std::shared_ptr<const StreamReaderWriter> streamReaderWriter)
+                    : m_streamReaderWriter(std::move(streamReaderWriter))
+                {
+                }
+
+                std::shared_ptr<std::istream> GetInputStream(const std::string& uri) const override
+                {
+                    auto stream = m_streamReaderWriter->GetInputStream(uri);
+                    stream->seekg(0);
+
+                    auto data = std::make_shared<const std::vector<uint8_t>>(std::istreambuf_iterator<char>(*stream), std::istreambuf_iterator<char>());
+                    auto dataPtr = data->data();
+                    auto dataSize = data->size();
+
+                    return std::make_shared<MemoryStream>(std::move(data), dataPtr, dataSize);
+                }
+
+            private:
+                std::shared_ptr<const StreamReaderWriter> m_streamReaderWriter;
+            };
+
+            // Returns the mean duration, in milliseconds, of the specified number of calls to fn (after an initial
+            // call to warm up any caches)
+            template<typename Fn>
+            double MeasureMilliseconds(Fn fn, size_t iterations = 5U)
+            {
+                fn();
+
+                const auto start = std::chrono::steady_clock::now();
+
+                for (size_t i = 0U; i < iterations; ++i)
+                {
+                    fn();
+                }
+
+                const std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+
+                return duration.count() / iterations;
+            }
+
             inline std::string GetAbsolutePath(const char * relativePath)
             {
 #ifndef _WIN32
@@ -0,0 +1,108 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/Exceptions.h>
+#include <GLTFSDK/ThreadPool.h>
+
+#include <atomic>
+
+using namespace glTF::UnitTest;
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(ThreadPoolTests)
+            {
+                GLTFSDK_TEST_METHOD(ThreadPoolTests, ThreadPool_ThreadCount)
+                {
+                    ThreadPool threadPool(3U);
+                    Assert::AreEqual<size_t>(3U, threadPool.GetThreadCount());
+
+                    ThreadPool threadPoolDefault;
+                    Assert::IsTrue(threadPoolDefault.GetThreadCount() > 0U);
+                }
+
+                GLTFSDK_TEST_METHOD(ThreadPoolTests, ThreadPool_Submit)
+                {
+                    ThreadPool threadPool(4U);
+
+                    std::vector<std::future<size_t>> futures;
+
+                    for (size_t i = 0U; i < 100U; ++i)
+                    {
+                        futures.push_back(threadPool.Submit([i]() { return i * i; }));
+                    }
+
+                    for (size_t i = 0U; i < futures.size(); ++i)
+                    {
+                        Assert::AreEqual(i * i, futures[i].get());
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(ThreadPoolTests, ThreadPool_Submit_Exception)
+                {
+                    ThreadPool threadPool(1U);
+
+                    auto future = threadPool.Submit([]() { throw GLTFException("Task failed"); });
+
+                    Assert::ExpectException<GLTFException>([&future]()
+                    {
+                        future.get();
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(ThreadPoolTests, ThreadPool_Destructor_CompletesQueuedTasks)
+                {
+                    std::atomic<size_t> completedCount(0U);
+
+                    {
+                        ThreadPool threadPool(2U);
+
+                        for (size_t i = 0U; i < 50U; ++i)
+                        {
+                            threadPool.Submit([&completedCount]() { ++completedCount; });
+                        }
+                    }
+
+                    Assert::AreEqual<size_t>(50U, completedCount);
+                }
+
+                GLTFSDK_TEST_METHOD(ThreadPoolTests, ThreadPool_NestedWait)
+                {
+                    // Every thread runs a task that waits for tasks submitted to the same pool
+                    ThreadPool threadPool(2U);
+
+                    std::atomic<size_t> completedCount(0U);
+
+                    auto submitNested = [&threadPool, &completedCount]()
+                    {
+                        FutureWaiter<void> waiter(threadPool);
+
+                        for (size_t i = 0U; i < 10U; ++i)
+                        {
+                            waiter.GetFutures().push_back(threadPool.Submit([&completedCount]() { ++completedCount; }));
+                        }
+
+                        waiter.Wait();
+                    };
+
+                    auto future0 = threadPool.Submit(submitNested);
+                    auto future1 = threadPool.Submit(submitNested);
+
+                    future0.get();
+                    future1.get();
+
+                    Assert::AreEqual<size_t>(20U, completedCount);
+
+                    // Threads that don't belong to the pool never run its tasks
+                    Assert::IsFalse(threadPool.TryExecutePending());
+                }
+            };
+        }
+    }
+}
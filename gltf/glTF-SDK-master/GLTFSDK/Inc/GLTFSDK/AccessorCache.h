@@ -0,0 +1,92 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <utility>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // A thread-safe cache of decoded accessor data, keyed by accessor id and element type. See
+        // GLTFResourceReader::SetAccessorCache. The cached data is immutable and shared, so accessors used by
+        // many mesh primitives or animation samplers are only validated, read and converted once.
+        //
+        // Accessor ids are only unique within a single document - a cache must only be used with one document.
+        class AccessorCache
+        {
+        public:
+            AccessorCache();
+
+            // Returns the accessor's cached data of type T, or nullptr if it isn't cached
+            template<typename T>
+            std::shared_ptr<const std::vector<T>> Find(const std::string& accessorId) const
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+
+                auto it = m_entries.find(Key(accessorId, typeid(T)));
+
+                if (it == m_entries.end())
+                {
+                    return nullptr;
+                }
+
+                return std::static_pointer_cast<const std::vector<T>>(it->second);
+            }
+
+            // Returns the accessor's cached data of type T, calling fnDecode (which returns std::vector<T>) to
+            // populate the cache on a miss. The cache isn't locked while decoding - if multiple threads decode
+            // the same accessor concurrently then the first data inserted is retained and returned to all.
+            template<typename T, typename Fn>
+            std::shared_ptr<const std::vector<T>> Get(const std::string& accessorId, Fn fnDecode)
+            {
+                const Key key(accessorId, typeid(T));
+
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+
+                    auto it = m_entries.find(key);
+
+                    if (it != m_entries.end())
+                    {
+                        ++m_hitCount;
+                        return std::static_pointer_cast<const std::vector<T>>(it->second);
+                    }
+
+                    ++m_missCount;
+                }
+
+                auto data = std::make_shared<const std::vector<T>>(fnDecode());
+
+                std::lock_guard<std::mutex> lock(m_mutex);
+
+                auto result = m_entries.emplace(key, std::move(data));
+                return std::static_pointer_cast<const std::vector<T>>(result.first->second);
+            }
+
+            void Clear();
+
+            size_t Size() const;
+
+            size_t GetHitCount() const;
+            size_t GetMissCount() const;
+
+        private:
+            typedef std::pair<std::string, std::type_index> Key;
+
+            std::map<Key, std::shared_ptr<const void>> m_entries;
+
+            size_t m_hitCount;
+            size_t m_missCount;
+
+            mutable std::mutex m_mutex;
+        };
+    }
+}
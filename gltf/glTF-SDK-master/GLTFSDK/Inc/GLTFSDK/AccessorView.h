@@ -0,0 +1,229 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/Deinterleave.h>
+#include <GLTFSDK/Exceptions.h>
+
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // A read-only view of an accessor's elements. Each element consists of GetTypeCount() components
+        // of type T and consecutive elements begin GetByteStride() bytes apart.
+        //
+        // Views returned by GLTFResourceReader::ReadAccessorView either reference buffer data that is
+        // already in memory (no copy is made) or own a tightly packed copy of the decoded data. In both
+        // cases the view keeps the referenced memory alive so it remains valid after the reader is gone.
+        template<typename T>
+        class AccessorView
+        {
+        public:
+            // Iterates over a view's elements, advancing GetByteStride() bytes at a time. Dereferencing
+            // returns a pointer to the element's first component
+            class ElementIterator
+            {
+            public:
+                typedef std::random_access_iterator_tag iterator_category;
+                typedef const T* value_type;
+                typedef std::ptrdiff_t difference_type;
+                typedef const T* const* pointer;
+                typedef const T* reference;
+
+                ElementIterator() : m_data(nullptr), m_byteStride(0U)
+                {
+                }
+
+                ElementIterator(const uint8_t* data, size_t byteStride) : m_data(data), m_byteStride(byteStride)
+                {
+                }
+
+                reference operator*() const
+                {
+                    return reinterpret_cast<const T*>(m_data);
+                }
+
+                reference operator[](difference_type n) const
+                {
+                    return *(*this + n);
+                }
+
+                ElementIterator& operator++()
+                {
+                    m_data += m_byteStride;
+                    return *this;
+                }
+
+                ElementIterator operator++(int)
+                {
+                    ElementIterator it = *this;
+                    ++(*this);
+                    return it;
+                }
+
+                ElementIterator& operator--()
+                {
+                    m_data -= m_byteStride;
+                    return *this;
+                }
+
+                ElementIterator operator--(int)
+                {
+                    ElementIterator it = *this;
+                    --(*this);
+                    return it;
+                }
+
+                ElementIterator& operator+=(difference_type n)
+                {
+                    m_data += n * static_cast<difference_type>(m_byteStride);
+                    return *this;
+                }
+
+                ElementIterator& operator-=(difference_type n)
+                {
+                    return *this += -n;
+                }
+
+                ElementIterator operator+(difference_type n) const
+                {
+                    ElementIterator it = *this;
+                    return it += n;
+                }
+
+                ElementIterator operator-(difference_type n) const
+                {
+                    ElementIterator it = *this;
+                    return it -= n;
+                }
+
+                difference_type operator-(const ElementIterator& other) const
+                {
+                    return m_byteStride ? (m_data - other.m_data) / static_cast<difference_type>(m_byteStride) : 0;
+                }
+
+                bool operator==(const ElementIterator& other) const { return m_data == other.m_data; }
+                bool operator!=(const ElementIterator& other) const { return m_data != other.m_data; }
+                bool operator<(const ElementIterator& other) const { return m_data < other.m_data; }
+                bool operator>(const ElementIterator& other) const { return m_data > other.m_data; }
+                bool operator<=(const ElementIterator& other) const { return m_data <= other.m_data; }
+                bool operator>=(const ElementIterator& other) const { return m_data >= other.m_data; }
+
+            private:
+                const uint8_t* m_data;
+                size_t         m_byteStride;
+            };
+
+            AccessorView() : m_data(nullptr), m_elementCount(0U), m_typeCount(0U), m_byteStride(0U)
+            {
+            }
+
+            // Constructs a view of memory kept alive by 'owner'
+            AccessorView(std::shared_ptr<const void> owner, const uint8_t* data, size_t elementCount, size_t typeCount, size_t byteStride) :
+                m_owner(std::move(owner)),
+                m_data(data),
+                m_elementCount(elementCount),
+                m_typeCount(typeCount),
+                m_byteStride(byteStride)
+            {
+                if (m_byteStride < sizeof(T) * m_typeCount)
+                {
+                    throw GLTFException("AccessorView byte stride is less than the element size");
+                }
+            }
+
+            // Constructs a view that takes ownership of tightly packed data
+            AccessorView(std::vector<T>&& data, size_t typeCount) :
+                AccessorView(std::make_shared<const std::vector<T>>(std::move(data)), typeCount)
+            {
+            }
+
+            size_t GetElementCount() const
+            {
+                return m_elementCount;
+            }
+
+            size_t GetTypeCount() const
+            {
+                return m_typeCount;
+            }
+
+            size_t GetComponentCount() const
+            {
+                return m_elementCount * m_typeCount;
+            }
+
+            size_t GetByteStride() const
+            {
+                return m_byteStride;
+            }
+
+            bool IsTightlyPacked() const
+            {
+                return m_byteStride == sizeof(T) * m_typeCount;
+            }
+
+            // Returns a pointer to GetComponentCount() contiguous components. Only valid for tightly packed views
+            const T* Data() const
+            {
+                if (!IsTightlyPacked())
+                {
+                    throw GLTFException("AccessorView::Data requires a tightly packed view");
+                }
+
+                return reinterpret_cast<const T*>(m_data);
+            }
+
+            // Returns a pointer to the first component of the specified element
+            const T* GetElement(size_t elementIndex) const
+            {
+                return reinterpret_cast<const T*>(m_data + elementIndex * m_byteStride);
+            }
+
+            ElementIterator begin() const
+            {
+                return ElementIterator(m_data, m_byteStride);
+            }
+
+            ElementIterator end() const
+            {
+                return ElementIterator(m_data + m_elementCount * m_byteStride, m_byteStride);
+            }
+
+            T Get(size_t elementIndex, size_t componentIndex) const
+            {
+                T value;
+                std::memcpy(&value, m_data + elementIndex * m_byteStride + componentIndex * sizeof(T), sizeof(T));
+                return value;
+            }
+
+            // Copies the view's components into a new, tightly packed, vector
+            std::vector<T> ToVector() const
+            {
+                std::vector<T> data(GetComponentCount());
+                Deinterleave(m_data, m_byteStride, m_elementCount, sizeof(T) * m_typeCount, data.data());
+                return data;
+            }
+
+        private:
+            AccessorView(std::shared_ptr<const std::vector<T>> data, size_t typeCount) :
+                AccessorView(data, reinterpret_cast<const uint8_t*>(data->data()), typeCount ? data->size() / typeCount : 0U, typeCount, sizeof(T) * typeCount)
+            {
+            }
+
+            std::shared_ptr<const void> m_owner;
+
+            const uint8_t* m_data;
+            size_t         m_elementCount;
+            size_t         m_typeCount;
+            size_t         m_byteStride;
+        };
+    }
+}
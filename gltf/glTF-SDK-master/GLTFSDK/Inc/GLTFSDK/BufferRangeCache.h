@@ -0,0 +1,106 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/ReadPlan.h>
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // A thread-safe cache of buffer data, keyed by source and buffer range, whose total size is limited to a byte
+        // budget. See GLTFResourceReader::SetBufferRangeCache.
+        //
+        // Buffer ids are only unique within a document, so each range is also keyed by the id of the source (e.g.
+        // the GLTFResourceReader) it was read from. This allows a cache to be shared by the readers of different
+        // documents without one reader being returned another's data.
+        //
+        // Eviction uses a segmented LRU policy: newly inserted ranges enter a 'probationary' segment and are only
+        // promoted to the 'protected' segment when they are requested again. Ranges are evicted from the
+        // probationary segment first so data that is read repeatedly (e.g. buffer views shared by many accessors
+        // or by instanced meshes) is not flushed by a single pass over a large amount of data that is only read
+        // once. The protected segment is limited to a fraction of the byte budget and overflows back into the
+        // probationary segment.
+        class BufferRangeCache
+        {
+        public:
+            explicit BufferRangeCache(size_t byteBudget, float protectedFraction = 0.8f);
+
+            // Returns a source id that is unique within the process
+            static uint64_t CreateSourceId();
+
+            // Returns the cached data for exactly the specified range of the source, or nullptr if the range isn't cached
+            std::shared_ptr<const std::vector<uint8_t>> Get(uint64_t sourceId, const BufferRange& bufferRange);
+
+            // Inserts the data for the specified range of the source (replacing any existing data for the range),
+            // evicting other ranges as required to stay within the byte budget. Returns false, and doesn't insert
+            // anything, if the data alone exceeds the byte budget.
+            bool Insert(uint64_t sourceId, const BufferRange& bufferRange, std::shared_ptr<const std::vector<uint8_t>> data);
+
+            void Clear();
+
+            size_t GetByteBudget() const;
+            size_t GetByteSize() const;
+
+            size_t GetHitCount() const;
+            size_t GetMissCount() const;
+            size_t GetEvictionCount() const;
+
+        private:
+            struct Key
+            {
+                uint64_t sourceId;
+                BufferRange bufferRange;
+
+                bool operator==(const Key& rhs) const
+                {
+                    return this->sourceId == rhs.sourceId
+                        && this->bufferRange == rhs.bufferRange;
+                }
+            };
+
+            struct Entry
+            {
+                Key key;
+                std::shared_ptr<const std::vector<uint8_t>> data;
+                bool isProtected;
+            };
+
+            typedef std::list<Entry> EntryList;
+
+            struct KeyHash
+            {
+                size_t operator()(const Key& key) const;
+            };
+
+            void Erase(EntryList::iterator it);
+            void Evict();
+
+            const size_t m_byteBudget;
+            const size_t m_protectedByteBudget;
+
+            // Both lists are ordered from most to least recently used
+            EntryList m_probationary;
+            EntryList m_protected;
+
+            std::unordered_map<Key, EntryList::iterator, KeyHash> m_entries;
+
+            size_t m_byteSize;
+            size_t m_protectedByteSize;
+
+            size_t m_hitCount;
+            size_t m_missCount;
+            size_t m_evictionCount;
+
+            mutable std::mutex m_mutex;
+        };
+    }
+}
@@ -0,0 +1,27 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // Copies elementCount elements, each elementSize bytes long and beginning srcByteStride bytes apart,
+        // from src into dst so that they are tightly packed. The source data must contain at least
+        // (elementCount - 1) * srcByteStride + elementSize bytes and dst at least elementCount * elementSize.
+        //
+        // Common vertex attribute sizes (e.g. 12 byte positions and normals, 16 byte tangents and colors)
+        // are copied with fixed size (SSE2 where available) loads and stores rather than a generic memcpy.
+        void Deinterleave(const void* src, size_t srcByteStride, size_t elementCount, size_t elementSize, void* dst);
+
+        // Copies elementCount tightly packed elements, each elementSize bytes long, from src into dst so that
+        // the i'th element is written to element indices[i] of dst (i.e. the inverse of a gather). Indices are
+        // not bounds checked. When an index is repeated the last of its elements is retained. Used to apply
+        // sparse accessor values to their base data.
+        void Scatter(const void* src, const uint32_t* indices, size_t elementCount, size_t elementSize, void* dst);
+    }
+}
@@ -11,10 +11,19 @@ namespace Microsoft
     namespace glTF
     {
         // IgnoreByteOrderMark -> According to the spec, "JSON must use UTF-8 encoding without BOM". Specifying this flag will ignore the presence of a byte order mark rather than treating it as an error.
+        // Skip* -> The specified sections are not deserialized, for jobs that only need part of a document. References to skipped objects (e.g. MeshPrimitive::materialId) are retained so the resulting Document may not pass validation.
+        // ValidateWhileParsing -> Schema validation is performed on the parse events as they are deserialized rather than on a DOM of the entire manifest, so the json is only traversed once. A schema violation still throws a ValidationException, although elements preceding the violation may already have been deserialized.
         enum class DeserializeFlags
         {
             None = 0x0,
-            IgnoreByteOrderMark = 0x1
+            IgnoreByteOrderMark = 0x1,
+            SkipAnimations = 0x2,
+            SkipSkins = 0x4,
+            SkipMaterials = 0x8,
+            SkipImages = 0x10,
+            SkipExtensions = 0x20, // The extensions of all glTF properties (extensionsUsed and extensionsRequired are still deserialized)
+            SkipExtras = 0x40,     // The extras of all glTF properties
+            ValidateWhileParsing = 0x80
         };
 
         DeserializeFlags  operator| (DeserializeFlags lhs,  DeserializeFlags rhs);
@@ -23,11 +32,35 @@ namespace Microsoft
         DeserializeFlags& operator&=(DeserializeFlags& lhs, DeserializeFlags rhs);
 
         class ExtensionDeserializer;
+        class IExecutor;
+        class JsonArena;
 
+        // When schema validation is disabled (SchemaFlags::DisableSchemaRoot), or DeserializeFlags::ValidateWhileParsing
+        // is specified, the json is deserialized directly from parse events rather than first building a DOM of the
+        // entire manifest - only a single element of a top level array (e.g. one node or accessor) is held in a DOM at
+        // any time. Compiled schemas are cached (see GetDefaultSchemaCache) and shared by all calls.
         Document Deserialize(const std::string& json, DeserializeFlags flags = DeserializeFlags::None, SchemaFlags schemaFlags = SchemaFlags::None);
         Document Deserialize(const std::string& json, const ExtensionDeserializer& extensions, DeserializeFlags flags = DeserializeFlags::None, SchemaFlags schemaFlags = SchemaFlags::None);
 
+        // The DOM of the manifest is built in the arena (which is reset first) rather than a newly allocated pool, so
+        // a batch of manifests can be deserialized reusing the same memory. The arena is unused when the json is
+        // deserialized directly from parse events.
+        Document Deserialize(const std::string& json, JsonArena& arena, DeserializeFlags flags = DeserializeFlags::None, SchemaFlags schemaFlags = SchemaFlags::None);
+        Document Deserialize(const std::string& json, JsonArena& arena, const ExtensionDeserializer& extensions, DeserializeFlags flags = DeserializeFlags::None, SchemaFlags schemaFlags = SchemaFlags::None);
+
         Document Deserialize(std::istream& jsonStream, DeserializeFlags flags = DeserializeFlags::None, SchemaFlags schemaFlags = SchemaFlags::None);
         Document Deserialize(std::istream& jsonStream, const ExtensionDeserializer& extensions, DeserializeFlags flags = DeserializeFlags::None, SchemaFlags schemaFlags = SchemaFlags::None);
+
+        // Parses the null terminated json in situ - strings are unescaped and terminated within the buffer, so the
+        // json is only read once rather than also being copied into a separate DOM. The buffer's contents are
+        // undefined afterwards. The returned Document doesn't reference the buffer.
+        Document DeserializeInsitu(char* json, DeserializeFlags flags = DeserializeFlags::None, SchemaFlags schemaFlags = SchemaFlags::None);
+        Document DeserializeInsitu(char* json, const ExtensionDeserializer& extensions, DeserializeFlags flags = DeserializeFlags::None, SchemaFlags schemaFlags = SchemaFlags::None);
+
+        // Parses the elements of the top level arrays (accessors, nodes etc.) concurrently, in chunks, via the executor
+        // (e.g. a ThreadPool). The returned Document is identical to the one returned by Deserialize. Extension handlers
+        // may be called concurrently. Must not be called from one of the executor's threads as it waits for the tasks.
+        Document DeserializeParallel(const std::string& json, IExecutor& executor, DeserializeFlags flags = DeserializeFlags::None, SchemaFlags schemaFlags = SchemaFlags::None);
+        Document DeserializeParallel(const std::string& json, const ExtensionDeserializer& extensions, IExecutor& executor, DeserializeFlags flags = DeserializeFlags::None, SchemaFlags schemaFlags = SchemaFlags::None);
     }
 }
@@ -0,0 +1,45 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/Document.h>
+#include <GLTFSDK/ExtensionHandlers.h>
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        constexpr uint32_t SNAPSHOT_VERSION = 2U;
+
+        // A snapshot is a versioned binary encoding of a Document that can be loaded much faster than the equivalent
+        // json can be deserialized - there is no parsing, strings are copied directly and float arrays (e.g.
+        // Accessor::min and Node::weights) are copied with a single memcpy. A snapshot contains no pointers: a header
+        // records the offset and length of a section per top level array, so a snapshot can be loaded directly from
+        // a memory mapped file. Snapshots use the byte order of the machine that created them and are intended as a
+        // cache (e.g. of deserialized manifests) rather than an interchange format.
+        //
+        // Unregistered extensions (glTFProperty::extensions) and extras are stored as their json strings. Registered
+        // extensions are stored as the json strings produced by the ExtensionSerializer's handlers, a GLTFException
+        // is thrown if the Document contains a registered extension without a handler.
+        std::vector<uint8_t> CreateSnapshot(const Document& document);
+        std::vector<uint8_t> CreateSnapshot(const Document& document, const ExtensionSerializer& extensionSerializer);
+        void WriteSnapshot(const Document& document, std::ostream& stream);
+        void WriteSnapshot(const Document& document, std::ostream& stream, const ExtensionSerializer& extensionSerializer);
+
+        // Throws a GLTFException if the data isn't a snapshot of the current SNAPSHOT_VERSION, is truncated or is
+        // corrupt. Registered extensions are recreated by the ExtensionDeserializer's handlers, as with Deserialize
+        // any without a handler are stored in glTFProperty::extensions.
+        Document LoadSnapshot(const uint8_t* data, size_t byteLength);
+        Document LoadSnapshot(const uint8_t* data, size_t byteLength, const ExtensionDeserializer& extensionDeserializer);
+        // Reads the snapshot starting at the stream's current position. If the stream is a MemoryStream (e.g. from
+        // MemoryMappedStreamReader) the snapshot is loaded directly from its data rather than read via the stream.
+        Document LoadSnapshot(std::istream& stream);
+        Document LoadSnapshot(std::istream& stream, const ExtensionDeserializer& extensionDeserializer);
+    }
+}
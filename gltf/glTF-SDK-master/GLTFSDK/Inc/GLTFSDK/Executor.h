@@ -0,0 +1,101 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // Executes tasks asynchronously. GLTFResourceReader's asynchronous functions perform their reads via an
+        // IExecutor, so applications can run them on an existing pool of I/O threads or event loop.
+        class IExecutor
+        {
+        public:
+            virtual ~IExecutor() = default;
+
+            // Runs the task once, at some later point, on any thread. The task doesn't throw.
+            virtual void Execute(std::function<void()> task) = 0;
+
+            // Runs one of the executor's queued tasks on the calling thread, if it may, and returns whether it did.
+            // FutureWaiter calls it while waiting so that a task which submits tasks to the executor it is running
+            // on, and then waits for them, doesn't deadlock once all of the executor's threads are waiting.
+            virtual bool TryExecutePending()
+            {
+                return false;
+            }
+        };
+
+        // Runs fn via the executor. Any exception thrown by fn is stored in the returned future and rethrown
+        // by future::get
+        template<typename Fn>
+        std::future<typename std::result_of<Fn()>::type> Submit(IExecutor& executor, Fn fn)
+        {
+            typedef typename std::result_of<Fn()>::type Result;
+
+            auto task = std::make_shared<std::packaged_task<Result()>>(std::move(fn));
+            auto future = task->get_future();
+
+            executor.Execute([task]() { (*task)(); });
+
+            return future;
+        }
+
+        // Holds the futures of submitted tasks and waits for all of them on destruction. Tasks that reference
+        // objects owned by the submitting function must complete before it returns, including when it throws,
+        // as a std::future obtained from a packaged_task doesn't block in its destructor. If constructed with the
+        // executor the tasks were submitted to, its queued tasks are run while waiting (see TryExecutePending).
+        template<typename T>
+        class FutureWaiter
+        {
+        public:
+            FutureWaiter() = default;
+
+            explicit FutureWaiter(IExecutor& executor) : m_executor(&executor)
+            {
+            }
+
+            FutureWaiter(const FutureWaiter&) = delete;
+            FutureWaiter& operator=(const FutureWaiter&) = delete;
+
+            ~FutureWaiter()
+            {
+                Wait();
+            }
+
+            void Wait()
+            {
+                for (auto& future : m_futures)
+                {
+                    if (future.valid())
+                    {
+                        // Once nothing is queued the task being waited for is running on another thread
+                        while (m_executor &&
+                            future.wait_for(std::chrono::seconds(0)) != std::future_status::ready &&
+                            m_executor->TryExecutePending())
+                        {
+                        }
+
+                        future.wait();
+                    }
+                }
+            }
+
+            std::vector<std::future<T>>& GetFutures()
+            {
+                return m_futures;
+            }
+
+        private:
+            IExecutor* m_executor = nullptr;
+            std::vector<std::future<T>> m_futures;
+        };
+    }
+}
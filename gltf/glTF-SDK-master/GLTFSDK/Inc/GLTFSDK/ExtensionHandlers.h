@@ -183,6 +183,9 @@ namespace Microsoft
 
         class Document;
 
+        // A parsed JSON value - defined in RapidJsonUtils.h
+        struct JsonValue;
+
         class ExtensionSerializer final : public ExtensionHandlers<std::string, Extension, Document, ExtensionSerializer>
         {
         public:
@@ -192,7 +195,63 @@ namespace Microsoft
         class ExtensionDeserializer final : public ExtensionHandlers<std::unique_ptr<Extension>, std::string, ExtensionDeserializer>
         {
         public:
+            typedef std::function<std::unique_ptr<Extension>(const JsonValue&, const ExtensionDeserializer&)> ValueFunc;
+
+            // Adds a handler that is passed the extension's JSON value as already parsed from the manifest, rather
+            // than the value serialized to a string that the handler must then parse again. The handler is also
+            // used (after parsing the string) when deserializing an ExtensionPair.
+            template<typename TExt, typename Fn>
+            void AddValueHandler(const std::string& name, Fn fn)
+            {
+                AddValueHandler<TExt, glTFPropertyAll>(name, fn);
+            }
+
+            template<typename TExt, typename TProp, typename Fn>
+            void AddValueHandler(const std::string& name, Fn fn)
+            {
+                ValueFunc fnValue = fn;
+
+                AddHandler<TExt, TProp>(name, [fnValue](const std::string& json, const ExtensionDeserializer& extensionDeserializer)
+                {
+                    return DeserializeString(json, extensionDeserializer, fnValue);
+                });
+
+                valueHandlers.emplace(Detail::MakeTypeKey<TExt, TProp>(), std::move(fnValue));
+            }
+
             std::unique_ptr<Extension> Deserialize(const ExtensionPair& extensionPair, const glTFProperty& property) const;
+
+            // Calls the handler added with AddValueHandler directly, otherwise the value is serialized and passed to
+            // the handler added with AddHandler
+            std::unique_ptr<Extension> Deserialize(const std::string& name, const JsonValue& value, const glTFProperty& property) const;
+
+            typedef std::function<void(const JsonValue&, glTFProperty&)> ExtrasFunc;
+            typedef std::function<void(const std::string&, const JsonValue&, glTFProperty&)> UnhandledExtensionFunc;
+
+            // Sets a handler that is passed each property's extras as the JSON value already parsed from the manifest,
+            // along with the property being deserialized. The extras are then not serialized to glTFProperty::extras:
+            // the handler keeps only what it needs (e.g. in an Extension set on the property, or an ExtrasDocument)
+            // and nothing is serialized unless it does so itself. Pass nullptr to restore the default behavior. The
+            // handler may be called concurrently by DeserializeParallel.
+            void SetExtrasHandler(ExtrasFunc fn);
+            // As above, for each extension that has no registered handler (rather than serializing its value to
+            // glTFProperty::extensions)
+            void SetUnhandledExtensionHandler(UnhandledExtensionFunc fn);
+
+            // Calls the handler set with SetExtrasHandler, otherwise serializes the value to property.extras
+            void DeserializeExtras(const JsonValue& value, glTFProperty& property) const;
+            // Calls the handler set with SetUnhandledExtensionHandler, otherwise serializes the value to property.extensions
+            void DeserializeUnhandledExtension(const std::string& name, const JsonValue& value, glTFProperty& property) const;
+
+        private:
+            Detail::TypeKey FindTypeKey(const std::string& name, const glTFProperty& property) const;
+
+            static std::unique_ptr<Extension> DeserializeString(const std::string& json, const ExtensionDeserializer& extensionDeserializer, const ValueFunc& fn);
+
+            std::unordered_map<Detail::TypeKey, ValueFunc, Hash> valueHandlers;
+
+            ExtrasFunc extrasHandler;
+            UnhandledExtensionFunc unhandledExtensionHandler;
         };
     }
 }
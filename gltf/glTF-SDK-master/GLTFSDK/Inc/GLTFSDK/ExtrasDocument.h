@@ -24,6 +24,12 @@ namespace Microsoft
                 }
             }
 
+            // Copies an already parsed value, e.g. the value passed to an ExtensionDeserializer extras handler
+            explicit ExtrasDocument(const JsonValue& extras)
+            {
+                m_document.CopyFrom(extras.value, m_document.GetAllocator());
+            }
+
             template<typename T>
             T GetValueOrDefault(T t = {}) const
             {
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <GLTFSDK/Deserialize.h>
 #include <GLTFSDK/GLTFResourceReader.h>
 
 namespace Microsoft
@@ -18,8 +19,16 @@ namespace Microsoft
             std::shared_ptr<std::istream> GetBinaryStream(const Buffer& buffer) const override;
             std::streampos                GetBinaryStreamPos(const Buffer& buffer) const override;
 
+            bool CanReadAt(const Buffer& buffer) const override;
+
             const std::string& GetJson() const;
 
+            // Deserializes the JSON chunk in situ (see DeserializeInsitu), parsing the reader's only copy of the
+            // chunk rather than copying it again into a separate DOM. The chunk's memory is released, so GetJson
+            // returns an empty string afterwards.
+            Document DeserializeJson(DeserializeFlags flags = DeserializeFlags::None, SchemaFlags schemaFlags = SchemaFlags::None);
+            Document DeserializeJson(const ExtensionDeserializer& extensions, DeserializeFlags flags = DeserializeFlags::None, SchemaFlags schemaFlags = SchemaFlags::None);
+
         private:
             void Init();
 
@@ -5,13 +5,28 @@
 
 #include <GLTFSDK/GLTF.h>
 #include <GLTFSDK/GLTFResourceWriter.h>
+#include <GLTFSDK/Serialize.h>
 
+#include <fstream>
+#include <functional>
 #include <memory>
 
 namespace Microsoft
 {
     namespace glTF
     {
+        // A read/write file stream that can be passed to GLBResourceWriter as its temporary buffer so the BIN chunk is
+        // staged on disk rather than in memory. The file is deleted when the stream is destroyed
+        class TemporaryFileStream : public std::fstream
+        {
+        public:
+            explicit TemporaryFileStream(std::string path);
+            ~TemporaryFileStream() override;
+
+        private:
+            std::string m_path;
+        };
+
         class GLBResourceWriter : public GLTFResourceWriter
         {
         public:
@@ -21,10 +36,17 @@ namespace Microsoft
             GLBResourceWriter(std::unique_ptr<IStreamWriterCache> streamCache, std::unique_ptr<std::iostream> tempBufferStream);
 
             void Flush(const std::string& manifest, const std::string& uri);
+
+            // Serializes the document straight into the JSON chunk rather than requiring the manifest as a string. The
+            // document is serialized twice, first to measure the manifest's length for the GLB header
+            void Flush(const Document& document, const ExtensionSerializer& extensionSerializer, const std::string& uri, SerializeFlags flags = SerializeFlags::None);
+
             std::string GenerateBufferUri(const std::string& bufferId) const override;
             std::ostream* GetBufferStream(const std::string& bufferId) override;
 
         private:
+            void WriteGLB(const std::string& uri, size_t manifestLength, const std::function<void(std::ostream&)>& writeManifest);
+
             std::shared_ptr<std::iostream> m_stream;
         };
     }
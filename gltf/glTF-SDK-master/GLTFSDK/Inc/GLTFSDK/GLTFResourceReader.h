@@ -3,19 +3,62 @@
 
 #pragma once
 
+#include <GLTFSDK/AccessorCache.h>
+#include <GLTFSDK/AccessorView.h>
+#include <GLTFSDK/BufferRangeCache.h>
+#include <GLTFSDK/Deinterleave.h>
 #include <GLTFSDK/Document.h>
+#include <GLTFSDK/Executor.h>
+#include <GLTFSDK/IRandomAccessReader.h>
 #include <GLTFSDK/IStreamReader.h>
+#include <GLTFSDK/MemoryStream.h>
+#include <GLTFSDK/ReadPlan.h>
 #include <GLTFSDK/ResourceReaderUtils.h>
+#include <GLTFSDK/SparseAccessorView.h>
 #include <GLTFSDK/StreamCacheLRU.h>
 #include <GLTFSDK/StreamUtils.h>
+#include <GLTFSDK/ThreadPool.h>
 #include <GLTFSDK/Validation.h>
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace Microsoft
 {
     namespace glTF
     {
+        // Identifies the buffer ranges and images stored in memory by a single call to GLTFResourceReader::Prefetch.
+        // Passing it to ClearPrefetched releases exactly those, leaving anything prefetched by other calls in place.
+        class PrefetchHandle
+        {
+        public:
+            // Returns true if the call to Prefetch stored nothing, i.e. all the plan's data was already in memory
+            bool IsEmpty() const
+            {
+                return m_bufferRanges.empty() && m_images.empty();
+            }
+
+        private:
+            friend class GLTFResourceReader;
+
+            // The data is only referenced weakly so the handle doesn't extend its lifetime and, once released,
+            // can't match data that is prefetched later
+            std::vector<std::pair<std::string, std::weak_ptr<const std::vector<uint8_t>>>> m_bufferRanges; // Buffer id and data
+            std::vector<std::pair<std::string, std::weak_ptr<const std::vector<uint8_t>>>> m_images;       // Uri and data
+        };
+
+        // All const member functions may be called concurrently from multiple threads. Access to the shared,
+        // per-uri, buffer streams is serialized (each read repositions the stream) but data that is already
+        // in memory - prefetched ranges, base64 data uris and MemoryStream backed buffers (see
+        // MemoryMappedStreamReader) - is decoded without holding any lock.
         class GLTFResourceReader
         {
         public:
@@ -25,7 +68,10 @@ namespace Microsoft
             }
 
             GLTFResourceReader(std::unique_ptr<IStreamReaderCache> streamCache)
-                : m_streamReaderCache(std::move(streamCache))
+                : m_streamReaderCache(std::move(streamCache)),
+                m_mutex(std::make_unique<std::mutex>()),
+                m_bufferRangeCacheSourceId(BufferRangeCache::CreateSourceId()),
+                m_decodeDataUrisOnce(false)
             {
             }
 
@@ -54,13 +100,22 @@ namespace Microsoft
                 {
                     data = ReadBinaryDataUri<uint8_t>({ itBegin, itEnd });
                 }
-                else if (auto stream = m_streamReaderCache->Get(image.uri))
-                {
-                    data = StreamUtils::ReadBinaryFull<uint8_t>(*stream);
-                }
                 else
                 {
-                    throw GLTFException("Unable to read image data");
+                    std::shared_ptr<const std::vector<uint8_t>> prefetchedData;
+
+                    {
+                        std::lock_guard<std::mutex> lock(*m_mutex);
+
+                        auto it = m_prefetchedImages.find(image.uri);
+
+                        if (it != m_prefetchedImages.end())
+                        {
+                            prefetchedData = it->second;
+                        }
+                    }
+
+                    data = prefetchedData ? *prefetchedData : ReadImageData(image.uri);
                 }
 
                 return data;
@@ -69,45 +124,116 @@ namespace Microsoft
             template<typename T>
             std::vector<T> ReadBinaryData(const Document& gltfDocument, const Accessor& accessor) const
             {
-                bool isValid;
+                if (m_accessorCache)
+                {
+                    return *ReadBinaryDataShared<T>(gltfDocument, accessor);
+                }
 
-                switch (accessor.componentType)
+                return DecodeBinaryData<T>(gltfDocument, accessor);
+            }
+
+            // Returns the accessor's data as a shared, immutable, array. If an accessor cache has been set (see
+            // SetAccessorCache) the data is only decoded the first time the accessor is read.
+            template<typename T>
+            std::shared_ptr<const std::vector<T>> ReadBinaryDataShared(const Document& gltfDocument, const Accessor& accessor) const
+            {
+                if (m_accessorCache)
                 {
-                case COMPONENT_BYTE:
-                    isValid = std::is_same<T, int8_t>::value;
-                    break;
-                case COMPONENT_UNSIGNED_BYTE:
-                    isValid = std::is_same<T, uint8_t>::value;
-                    break;
-                case COMPONENT_SHORT:
-                    isValid = std::is_same<T, int16_t>::value;
-                    break;
-                case COMPONENT_UNSIGNED_SHORT:
-                    isValid = std::is_same<T, uint16_t>::value;
-                    break;
-                case COMPONENT_UNSIGNED_INT:
-                    isValid = std::is_same<T, uint32_t>::value;
-                    break;
-                case COMPONENT_FLOAT:
-                    isValid = std::is_same<T, float>::value;
-                    break;
-                default:
-                    throw GLTFException("Unsupported accessor ComponentType");
+                    // Validated before the lookup as the cache entry may have been decoded by ReadFloatData (i.e. a
+                    // normalized integer accessor stored as floats) rather than read as T
+                    ValidateComponentType<T>(accessor);
+                    Validation::ValidateAccessor(gltfDocument, accessor);
+
+                    return m_accessorCache->Get<T>(accessor.id, [&]()
+                    {
+                        return DecodeBinaryData<T>(gltfDocument, accessor);
+                    });
                 }
 
-                if (!isValid)
+                return std::make_shared<const std::vector<T>>(DecodeBinaryData<T>(gltfDocument, accessor));
+            }
+
+            // Reads the accessor's data into a caller provided buffer with space for 'capacity' components of
+            // type T. Returns the number of components written, i.e. accessor.count * typeCount. Throws if the
+            // buffer is too small. Tightly packed data is copied or decoded straight into the buffer, but a
+            // temporary copy is still allocated when reading a sparse accessor (its indices widened to uint32_t
+            // and its values), an interleaved bufferView of a base64 encoded buffer (the decoded range) or of a
+            // buffer read via its stream (a staging chunk of up to 1MB), and when a BufferRangeCache is set and
+            // the bufferView isn't yet cached (the cached copy of the bufferView).
+            template<typename T>
+            size_t ReadBinaryData(const Document& gltfDocument, const Accessor& accessor, T* data, size_t capacity) const
+            {
+                ValidateComponentType<T>(accessor);
+                Validation::ValidateAccessor(gltfDocument, accessor);
+
+                const size_t componentCount = accessor.count * Accessor::GetTypeCount(accessor.type);
+
+                if (componentCount > capacity)
                 {
-                    throw GLTFException("ReadAccessorData: Template type T does not match accessor ComponentType");
+                    throw GLTFException("The output buffer is too small for the data of accessor " + accessor.id);
                 }
 
+                // Previously cached data is copied but, to avoid allocating, the cache is never populated
+                if (auto cachedData = FindCachedData<T>(accessor))
+                {
+                    std::copy(cachedData->begin(), cachedData->end(), data);
+                    return cachedData->size();
+                }
+
+                ReadAccessorData<T>(gltfDocument, accessor, data);
+                return componentCount;
+            }
+
+            // Returns a view of the accessor's data. If the buffer's stream is a MemoryStream (see
+            // MemoryMappedStreamReader) the view references the stream's memory directly, including
+            // when the accessor's bufferView is interleaved. Sparse accessors, base64 encoded buffers
+            // and buffers that are not in memory fall back to a view of a decoded copy of the data.
+            template<typename T>
+            AccessorView<T> ReadAccessorView(const Document& gltfDocument, const Accessor& accessor) const
+            {
+                ValidateComponentType<T>(accessor);
                 Validation::ValidateAccessor(gltfDocument, accessor);
 
-                if (accessor.sparse.count > 0U)
+                AccessorView<T> view;
+
+                if (accessor.sparse.count == 0U && !accessor.bufferViewId.empty() && GetInMemoryAccessorView<T>(gltfDocument, accessor, view))
+                {
+                    return view;
+                }
+
+                return AccessorView<T>(ReadBinaryData<T>(gltfDocument, accessor), Accessor::GetTypeCount(accessor.type));
+            }
+
+            // Returns a view of the accessor's data that overlays any sparse values on the accessor's base data
+            // (see ReadAccessorView) rather than densifying them. Only the sparse indices and values are copied
+            // when the base data is in memory, or when the accessor has no bufferView (its base data is zeros).
+            template<typename T>
+            SparseAccessorView<T> ReadSparseAccessorView(const Document& gltfDocument, const Accessor& accessor) const
+            {
+                ValidateComponentType<T>(accessor);
+                Validation::ValidateAccessor(gltfDocument, accessor);
+
+                if (accessor.sparse.count == 0U)
+                {
+                    return SparseAccessorView<T>(ReadAccessorView<T>(gltfDocument, accessor));
+                }
+
+                const auto typeCount = Accessor::GetTypeCount(accessor.type);
+                const bool hasBaseView = !accessor.bufferViewId.empty();
+
+                AccessorView<T> baseView;
+
+                if (hasBaseView && !GetInMemoryAccessorView<T>(gltfDocument, accessor, baseView))
                 {
-                    return ReadSparseAccessor<T>(gltfDocument, accessor);
+                    baseView = AccessorView<T>(ReadAccessor<T>(gltfDocument, accessor), typeCount);
                 }
 
-                return ReadAccessor<T>(gltfDocument, accessor);
+                std::vector<uint32_t> sparseIndices;
+                std::vector<T> sparseValues;
+
+                ReadSparseData<T>(gltfDocument, accessor, sparseIndices, sparseValues);
+
+                return SparseAccessorView<T>(std::move(baseView), hasBaseView, accessor.count, typeCount, std::move(sparseIndices), std::move(sparseValues));
             }
 
             template<typename T>
@@ -124,78 +250,173 @@ namespace Microsoft
             }
 
             std::vector<float> ReadFloatData(const Document& gltfDocument, const Accessor& accessor) const;
+            std::shared_ptr<const std::vector<float>> ReadFloatDataShared(const Document& gltfDocument, const Accessor& accessor) const;
+
+            // Reads the accessor's data, converted to floats, into a caller provided buffer with space for
+            // 'capacity' floats. Returns the number of floats written. Throws if the buffer is too small.
+            // No memory is allocated for (non-sparse) accessors whose component type is float.
+            size_t ReadFloatData(const Document& gltfDocument, const Accessor& accessor, float* data, size_t capacity) const;
+
+            // Reads each of the plan's (merged) buffer ranges into memory with a single sequential read, in
+            // ascending offset order, followed by each of the plan's external image uris. Subsequent reads of
+            // data lying entirely within a prefetched range, e.g. the accessors used to construct the plan, and
+            // of the prefetched images are served from memory. Ranges already in memory (i.e. buffers backed by
+            // a MemoryStream) are not copied.
+            //
+            // Returns a handle to the ranges and images stored by this call, i.e. excluding those already in memory.
+            // Passing it to ClearPrefetched releases only what this call prefetched.
+            PrefetchHandle Prefetch(const Document& document, const ReadPlan& plan) const;
+
+            // Releases the memory used by all previously prefetched buffer ranges, images and decoded base64 data uris
+            void ClearPrefetched() const;
+            // Releases the memory used by prefetched buffer ranges that lie within the plan's buffer ranges and
+            // by the plan's prefetched images
+            void ClearPrefetched(const ReadPlan& plan) const;
+            // Releases the memory used by the buffer ranges and images stored by a single call to Prefetch
+            void ClearPrefetched(const PrefetchHandle& handle) const;
+
+            // When enabled, the first read of a base64 data uri buffer decodes the entire buffer and retains it (as
+            // a prefetched range) so that every other read of the buffer - each accessor, buffer view and sparse
+            // accessor's indices and values - is a copy from memory. Otherwise only the requested range is decoded,
+            // on every read. The decoded data is keyed by buffer id, so a reader with this enabled should only be
+            // used with one document. Disabled by default.
+            void SetDecodeDataUrisOnce(bool decodeDataUrisOnce);
+            bool GetDecodeDataUrisOnce() const;
+
+            // Sets a cache of decoded accessor data. While set, ReadBinaryData, ReadFloatData and their Shared
+            // variants (and so MeshPrimitiveUtils and AnimationUtils) decode each accessor once and then return
+            // (copies of) the cached data. Pass nullptr to stop caching.
+            void SetAccessorCache(std::shared_ptr<AccessorCache> accessorCache);
+            const std::shared_ptr<AccessorCache>& GetAccessorCache() const;
+
+            // Sets a cache of buffer view data used by subsequent accessor reads. When an accessor is read its entire
+            // buffer view is cached so that other accessors in the same buffer view (e.g. interleaved vertex
+            // attributes) and repeated reads are served from memory. Buffer views that are already in memory or
+            // that exceed the cache's byte budget are not cached. Ranges are keyed by this reader and the buffer id,
+            // so a cache can be shared by the readers of different documents. Pass nullptr to stop caching.
+            void SetBufferRangeCache(std::shared_ptr<BufferRangeCache> bufferRangeCache);
+            const std::shared_ptr<BufferRangeCache>& GetBufferRangeCache() const;
+
+            // Decodes the data of every accessor in the document, distributing the accessors across the
+            // executor's threads (e.g. a ThreadPool). Returns the tightly packed components of each accessor (of the type
+            // specified by the accessor's componentType) in the same order as document.accessors. If any
+            // accessor fails to decode then the first such exception is rethrown once all tasks complete.
+            std::vector<std::vector<uint8_t>> ReadAccessorsParallel(const Document& document, IExecutor& executor) const;
+            // As above but only decodes the specified accessors, returning their data in the same order. Throws,
+            // without decoding any accessor, if an id doesn't match an accessor in the document.
+            std::vector<std::vector<uint8_t>> ReadAccessorsParallel(const Document& document, const std::vector<std::string>& accessorIds, IExecutor& executor) const;
+
+            // Sets the executor used by the asynchronous (Async suffixed) functions. Pass nullptr to use a
+            // ThreadPool, shared by all readers, that is created on first use.
+            void SetExecutor(std::shared_ptr<IExecutor> executor);
+            const std::shared_ptr<IExecutor>& GetExecutor() const;
+
+            // Sets a reader used to read the data of external (uri) buffers with stateless positional reads rather
+            // than a seekg and read of the buffer's shared stream. Unlike stream reads, which are serialized, reads
+            // of a random access reader don't hold any lock so concurrent reads (e.g. ReadAccessorsParallel) of the
+            // same buffer proceed in parallel. External images are read with it too. Pass nullptr to read buffers
+            // and images via their streams.
+            void SetRandomAccessReader(std::shared_ptr<const IRandomAccessReader> randomAccessReader);
+            const std::shared_ptr<const IRandomAccessReader>& GetRandomAccessReader() const;
+
+            // Asynchronous variants of ReadBinaryData, ReadFloatData and Prefetch that run via the reader's
+            // executor, so the calling thread isn't blocked on buffer I/O. Any exception is rethrown by
+            // future::get. The document and the reader must outlive the returned futures.
+            template<typename T>
+            std::future<std::vector<T>> ReadBinaryDataAsync(const Document& gltfDocument, const Accessor& accessor) const
+            {
+                return Submit(GetAsyncExecutor(), [this, &gltfDocument, accessor]()
+                {
+                    return ReadBinaryData<T>(gltfDocument, accessor);
+                });
+            }
+
+            template<typename T>
+            std::future<std::vector<T>> ReadBinaryDataAsync(const Document& gltfDocument, const BufferView& bufferView) const
+            {
+                return Submit(GetAsyncExecutor(), [this, &gltfDocument, bufferView]()
+                {
+                    return ReadBinaryData<T>(gltfDocument, bufferView);
+                });
+            }
+
+            std::future<std::vector<uint8_t>> ReadBinaryDataAsync(const Document& document, const Image& image) const;
+            std::future<std::vector<float>> ReadFloatDataAsync(const Document& gltfDocument, const Accessor& accessor) const;
+            std::future<PrefetchHandle> PrefetchAsync(const Document& document, const ReadPlan& plan) const;
 
         protected:
             template<typename T>
             std::vector<T> ReadAccessor(const Document& gltfDocument, const Accessor& accessor) const
+            {
+                std::vector<T> data(accessor.count * Accessor::GetTypeCount(accessor.type));
+                ReadAccessor<T>(gltfDocument, accessor, data.data());
+                return data;
+            }
+
+            template<typename T>
+            void ReadAccessor(const Document& gltfDocument, const Accessor& accessor, T* data) const
             {
                 const auto typeCount = Accessor::GetTypeCount(accessor.type);
                 const auto elementSize = sizeof(T) * typeCount;
 
-                std::vector<T> data;
-
                 const BufferView& bufferView = gltfDocument.bufferViews.Get(accessor.bufferViewId);
                 const Buffer& buffer = gltfDocument.buffers.Get(bufferView.bufferId);
 
+                if (auto bufferViewData = GetCachedBufferViewData(buffer, bufferView))
+                {
+                    const size_t byteStride = bufferView.byteStride ? bufferView.byteStride.Get() : elementSize;
+                    const size_t byteLength = bufferViewData->size() - std::min(accessor.byteOffset, bufferViewData->size());
+
+                    // Every element but the last occupies a full stride
+                    if (accessor.count > 0U && (byteLength < elementSize || (byteLength - elementSize) / byteStride < accessor.count - 1U))
+                    {
+                        throw GLTFException("Accessor " + accessor.id + " data range is outside the bounds of its buffer view");
+                    }
+
+                    Deinterleave(bufferViewData->data() + accessor.byteOffset, byteStride, accessor.count, elementSize, data);
+                    return;
+                }
+
                 const size_t offset = accessor.byteOffset + bufferView.byteOffset;
 
                 if (!bufferView.byteStride || bufferView.byteStride.Get() == elementSize)
                 {
-                    data = ReadBinaryData<T>(buffer, offset, accessor.count * typeCount);
+                    ReadBinaryData<T>(buffer, offset, accessor.count * typeCount, data);
                 }
                 else
                 {
-                    data = ReadBinaryDataInterleaved<T>(buffer, offset, accessor.count, typeCount, bufferView.byteStride.Get());
+                    ReadBinaryDataInterleaved<T>(buffer, offset, accessor.count, typeCount, bufferView.byteStride.Get(), data);
                 }
+            }
 
+            template<typename T>
+            std::vector<T> ReadSparseAccessor(const Document& gltfDocument, const Accessor& accessor) const
+            {
+                std::vector<T> data(accessor.count * Accessor::GetTypeCount(accessor.type));
+                ReadSparseAccessor<T>(gltfDocument, accessor, data.data());
                 return data;
             }
 
             template<typename T>
-            std::vector<T> ReadSparseAccessor(const Document& gltfDocument, const Accessor& accessor) const
+            void ReadSparseAccessor(const Document& gltfDocument, const Accessor& accessor, T* data) const
             {
                 const auto typeCount = Accessor::GetTypeCount(accessor.type);
-                const auto elementSize = sizeof(T) * typeCount;
-
-                std::vector<T> baseData;
 
                 if (accessor.bufferViewId.empty())
                 {
-                    baseData.resize(typeCount * accessor.count, T());
+                    std::fill(data, data + accessor.count * typeCount, T());
                 }
                 else
                 {
-                    const BufferView& bufferView = gltfDocument.bufferViews.Get(accessor.bufferViewId);
-                    const Buffer& buffer = gltfDocument.buffers.Get(bufferView.bufferId);
-
-                    const size_t offset = accessor.byteOffset + bufferView.byteOffset;
-
-                    if (!bufferView.byteStride || bufferView.byteStride.Get() == elementSize)
-                    {
-                        baseData = ReadBinaryData<T>(buffer, offset, accessor.count * typeCount);
-                    }
-                    else
-                    {
-                        baseData = ReadBinaryDataInterleaved<T>(buffer, offset, accessor.count, typeCount, bufferView.byteStride.Get());
-                    }
+                    ReadAccessor<T>(gltfDocument, accessor, data);
                 }
 
-                switch (accessor.sparse.indicesComponentType)
-                {
-                case COMPONENT_UNSIGNED_BYTE:
-                    ReadSparseBinaryData<T, uint8_t>(gltfDocument, baseData, accessor);
-                    break;
-                case COMPONENT_UNSIGNED_SHORT:
-                    ReadSparseBinaryData<T, uint16_t>(gltfDocument, baseData, accessor);
-                    break;
-                case COMPONENT_UNSIGNED_INT:
-                    ReadSparseBinaryData<T, uint32_t>(gltfDocument, baseData, accessor);
-                    break;
-                default:
-                    throw GLTFException("Unsupported sparse indices ComponentType");
-                }
+                std::vector<uint32_t> sparseIndices;
+                std::vector<T> sparseValues;
 
-                return baseData;
+                ReadSparseData<T>(gltfDocument, accessor, sparseIndices, sparseValues);
+
+                Scatter(sparseValues.data(), sparseIndices.data(), sparseIndices.size(), sizeof(T) * typeCount, data);
             }
 
             virtual std::shared_ptr<std::istream> GetBinaryStream(const Buffer& buffer) const
@@ -213,7 +434,165 @@ namespace Microsoft
                 return {};
             }
 
+            // Returns true if the buffer's data should be read with the random access reader (see
+            // SetRandomAccessReader) rather than via its stream. Derived readers return false for buffers that
+            // aren't identified by their uri, e.g. the binary chunk of a GLB.
+            virtual bool CanReadAt(const Buffer& buffer) const
+            {
+                return m_randomAccessReader && !buffer.uri.empty();
+            }
+
+            // Returns a pointer to byteLength bytes of the buffer's data, starting at offset, if the range was
+            // prefetched, if the buffer is a base64 data uri (see SetDecodeDataUrisOnce) or if the buffer's stream
+            // is a MemoryStream. The returned shared_ptr keeps the memory alive. Otherwise returns nullptr, e.g.
+            // for any stream that doesn't support direct access.
+            std::shared_ptr<const uint8_t> GetBinaryData(const Buffer& buffer, size_t offset, size_t byteLength) const
+            {
+                if (auto prefetchedData = GetPrefetchedData(buffer, offset, byteLength))
+                {
+                    return prefetchedData;
+                }
+
+                if (IsUriBase64(buffer.uri))
+                {
+                    return m_decodeDataUrisOnce ? GetDataUriData(buffer, offset, byteLength) : nullptr;
+                }
+
+                // Buffers read via the random access reader have no stream
+                if (CanReadAt(buffer))
+                {
+                    return nullptr;
+                }
+
+                std::shared_ptr<const MemoryStream> memoryStream;
+
+                {
+                    std::lock_guard<std::mutex> lock(*m_mutex);
+                    memoryStream = std::dynamic_pointer_cast<const MemoryStream>(GetBinaryStream(buffer));
+                }
+
+                if (!memoryStream)
+                {
+                    return nullptr;
+                }
+
+                const std::streamoff streamPos = GetBinaryStreamPos(buffer);
+
+                if (streamPos < 0)
+                {
+                    throw GLTFException("Negative offsets are not supported");
+                }
+
+                size_t dataBegin;
+                size_t dataEnd;
+
+                if (!Validation::SafeAddition(static_cast<size_t>(streamPos), offset, dataBegin) ||
+                    !Validation::SafeAddition(dataBegin, byteLength, dataEnd) ||
+                    dataEnd > memoryStream->Size())
+                {
+                    throw GLTFException("Buffer data range is outside the bounds of the stream");
+                }
+
+                const uint8_t* data = memoryStream->Data() + dataBegin;
+                return std::shared_ptr<const uint8_t>(std::move(memoryStream), data);
+            }
+
         private:
+            struct PrefetchedRange
+            {
+                size_t byteOffset;
+                std::shared_ptr<const std::vector<uint8_t>> data;
+            };
+
+            std::shared_ptr<const uint8_t> GetPrefetchedData(const Buffer& buffer, size_t offset, size_t byteLength) const;
+
+            IExecutor& GetAsyncExecutor() const;
+
+            // Decodes the entirety of a base64 data uri buffer and retains it as a prefetched range, so every
+            // subsequent read of the buffer (until ClearPrefetched is called) is served without decoding again
+            std::shared_ptr<const uint8_t> GetDataUriData(const Buffer& buffer, size_t offset, size_t byteLength) const;
+
+            // Returns the buffer view's data from the buffer range cache, reading and inserting it on a miss.
+            // Returns nullptr if there is no cache or the buffer view shouldn't be cached.
+            std::shared_ptr<const std::vector<uint8_t>> GetCachedBufferViewData(const Buffer& buffer, const BufferView& bufferView) const;
+
+            // Reads byteLength bytes from the buffer's stream, starting at offset. The stream is shared by all
+            // reads of the same uri so its repositioning and reading are performed while holding m_mutex. Buffers
+            // read via the random access reader are read without any lock.
+            void ReadBinaryStream(const Buffer& buffer, std::streamoff offset, void* data, size_t byteLength) const;
+
+            // Reads all the data of an external image. Reads via the random access reader, or of a MemoryStream, don't
+            // hold any lock. Other streams are shared (see ReadBinaryStream) so are read while holding m_mutex.
+            std::vector<uint8_t> ReadImageData(const std::string& uri) const;
+
+            template<typename T>
+            std::vector<T> DecodeBinaryData(const Document& gltfDocument, const Accessor& accessor) const
+            {
+                ValidateComponentType<T>(accessor);
+                Validation::ValidateAccessor(gltfDocument, accessor);
+
+                std::vector<T> data(accessor.count * Accessor::GetTypeCount(accessor.type));
+                ReadAccessorData<T>(gltfDocument, accessor, data.data());
+                return data;
+            }
+
+            std::vector<float> DecodeFloatData(const Document& gltfDocument, const Accessor& accessor) const;
+
+            template<typename T>
+            std::shared_ptr<const std::vector<T>> FindCachedData(const Accessor& accessor) const
+            {
+                return m_accessorCache ? m_accessorCache->Find<T>(accessor.id) : nullptr;
+            }
+
+            // Reads the (already validated) accessor's data into a buffer with space for all its components
+            template<typename T>
+            void ReadAccessorData(const Document& gltfDocument, const Accessor& accessor, T* data) const
+            {
+                if (accessor.sparse.count > 0U)
+                {
+                    ReadSparseAccessor<T>(gltfDocument, accessor, data);
+                }
+                else
+                {
+                    ReadAccessor<T>(gltfDocument, accessor, data);
+                }
+            }
+
+            template<typename T>
+            static void ValidateComponentType(const Accessor& accessor)
+            {
+                bool isValid;
+
+                switch (accessor.componentType)
+                {
+                case COMPONENT_BYTE:
+                    isValid = std::is_same<T, int8_t>::value;
+                    break;
+                case COMPONENT_UNSIGNED_BYTE:
+                    isValid = std::is_same<T, uint8_t>::value;
+                    break;
+                case COMPONENT_SHORT:
+                    isValid = std::is_same<T, int16_t>::value;
+                    break;
+                case COMPONENT_UNSIGNED_SHORT:
+                    isValid = std::is_same<T, uint16_t>::value;
+                    break;
+                case COMPONENT_UNSIGNED_INT:
+                    isValid = std::is_same<T, uint32_t>::value;
+                    break;
+                case COMPONENT_FLOAT:
+                    isValid = std::is_same<T, float>::value;
+                    break;
+                default:
+                    throw GLTFException("Unsupported accessor ComponentType");
+                }
+
+                if (!isValid)
+                {
+                    throw GLTFException("ReadAccessorData: Template type T does not match accessor ComponentType");
+                }
+            }
+
             void ReadBinaryDataUri(Base64StringView encodedData, Base64BufferView decodedData, const std::streamoff* offsetOverride = nullptr) const
             {
                 // The number of unwanted extra bytes that must be decoded for the specified byte offset
@@ -287,121 +666,229 @@ namespace Microsoft
             template<typename T>
             std::vector<T> ReadBinaryData(const Buffer& buffer, std::streamoff offset, size_t componentCount) const
             {
-                std::vector<T> data;
+                std::vector<T> data(componentCount);
+                ReadBinaryData<T>(buffer, offset, componentCount, data.data());
+                return data;
+            }
+
+            template<typename T>
+            void ReadBinaryData(const Buffer& buffer, std::streamoff offset, size_t componentCount, T* data) const
+            {
+                const size_t byteLength = componentCount * sizeof(T);
+
+                if (byteLength == 0U)
+                {
+                    return;
+                }
 
                 std::string::const_iterator itBegin;
                 std::string::const_iterator itEnd;
 
-                if (IsUriBase64(buffer.uri, itBegin, itEnd))
+                if (auto bufferData = GetBinaryData(buffer, static_cast<size_t>(offset), byteLength))
                 {
-                    data = ReadBinaryDataUri<T>({ itBegin, itEnd }, &offset, &componentCount);
+                    std::memcpy(data, bufferData.get(), byteLength);
+                }
+                else if (IsUriBase64(buffer.uri, itBegin, itEnd))
+                {
+                    ReadBinaryDataUri({ itBegin, itEnd }, Base64BufferView(data, byteLength), &offset);
                 }
                 else
                 {
-                    data.resize(componentCount);
-
-                    auto bufferStream = GetBinaryStream(buffer);
-                    auto bufferStreamPos = GetBinaryStreamPos(buffer);
-
-                    bufferStream->seekg(bufferStreamPos);
-                    bufferStream->seekg(offset, std::ios_base::cur);
-
-                    StreamUtils::ReadBinary(*bufferStream, reinterpret_cast<char*>(data.data()), componentCount * sizeof(T));
+                    ReadBinaryStream(buffer, offset, data, byteLength);
                 }
+            }
 
+            template<typename T>
+            std::vector<T> ReadBinaryDataInterleaved(const Buffer& buffer, std::streamoff offset, size_t elementCount, uint8_t typeCount, size_t stride) const
+            {
+                std::vector<T> data(elementCount * typeCount);
+                ReadBinaryDataInterleaved<T>(buffer, offset, elementCount, typeCount, stride, data.data());
                 return data;
             }
 
             template<typename T>
-            std::vector<T> ReadBinaryDataInterleaved(const Buffer& buffer, std::streamoff offset, size_t elementCount, uint8_t typeCount, size_t stride) const
+            void ReadBinaryDataInterleaved(const Buffer& buffer, std::streamoff offset, size_t elementCount, uint8_t typeCount, size_t stride, T* data) const
             {
                 const size_t elementSize = sizeof(T) * typeCount;
-                const size_t componentCount = elementCount * typeCount;
 
-                std::vector<T> data(componentCount);
+                if (elementCount == 0U)
+                {
+                    return;
+                }
+
+                // Every element but the last occupies a full stride
+                const size_t byteLength = (elementCount - 1U) * stride + elementSize;
 
                 std::string::const_iterator itBegin;
                 std::string::const_iterator itEnd;
 
-                if (IsUriBase64(buffer.uri, itBegin, itEnd))
+                if (auto bufferData = GetBinaryData(buffer, static_cast<size_t>(offset), byteLength))
                 {
-                    Base64StringView encodedData(itBegin, itEnd);
-
-                    for (size_t componentsRead = 0U; componentsRead < componentCount; componentsRead += typeCount, offset += stride)
-                    {
-                        ReadBinaryDataUri(encodedData, Base64BufferView(data.data() + componentsRead, elementSize), &offset);
-                    }
+                    Deinterleave(bufferData.get(), stride, elementCount, elementSize, data);
+                }
+                else if (IsUriBase64(buffer.uri, itBegin, itEnd))
+                {
+                    // Decode the entire interleaved range once rather than once per element
+                    const auto interleavedData = ReadBinaryDataUri<uint8_t>({ itBegin, itEnd }, &offset, &byteLength);
+                    Deinterleave(interleavedData.data(), stride, elementCount, elementSize, data);
                 }
                 else
                 {
-                    auto bufferStream = GetBinaryStream(buffer);
-                    auto bufferStreamPos = GetBinaryStreamPos(buffer) + offset;
+                    // Read the interleaved range sequentially, in chunks of (approximately) a fixed size, rather
+                    // than seeking to each element in turn. This bounds the temporary memory required when the
+                    // stride is much larger than the element size.
+                    constexpr size_t chunkByteLengthMax = 1U << 20;
+
+                    const size_t chunkElementCountMax = std::max<size_t>(1U, chunkByteLengthMax / stride);
+
+                    std::vector<uint8_t> chunk;
 
-                    for (size_t componentsRead = 0U; componentsRead < componentCount; componentsRead += typeCount)
+                    for (size_t elementsRead = 0U; elementsRead < elementCount;)
                     {
-                        bufferStream->seekg(bufferStreamPos);
-                        bufferStreamPos += stride;
+                        const size_t chunkElementCount = std::min(chunkElementCountMax, elementCount - elementsRead);
 
-                        StreamUtils::ReadBinary(*bufferStream, reinterpret_cast<char*>(data.data() + componentsRead), elementSize);
+                        // Only read the final element's bytes, not the whole stride, as the remainder of the
+                        // stride may lie beyond the end of the buffer
+                        const size_t chunkByteLength = (elementsRead + chunkElementCount == elementCount) ?
+                            (chunkElementCount - 1U) * stride + elementSize :
+                            chunkElementCount * stride;
+
+                        chunk.resize(chunkByteLength);
+
+                        ReadBinaryStream(buffer, offset + static_cast<std::streamoff>(elementsRead * stride), chunk.data(), chunkByteLength);
+                        Deinterleave(chunk.data(), stride, chunkElementCount, elementSize, data + elementsRead * typeCount);
+
+                        elementsRead += chunkElementCount;
                     }
                 }
+            }
 
-                return data;
+            // Sets view to reference the accessor's (non-sparse) data directly and returns true if the data is
+            // already in memory (see GetBinaryData). Otherwise returns false.
+            template<typename T>
+            bool GetInMemoryAccessorView(const Document& gltfDocument, const Accessor& accessor, AccessorView<T>& view) const
+            {
+                const auto typeCount = Accessor::GetTypeCount(accessor.type);
+
+                const BufferView& bufferView = gltfDocument.bufferViews.Get(accessor.bufferViewId);
+                const Buffer& buffer = gltfDocument.buffers.Get(bufferView.bufferId);
+
+                const size_t elementSize = sizeof(T) * typeCount;
+                const size_t byteStride = bufferView.byteStride ? bufferView.byteStride.Get() : elementSize;
+                const size_t byteLength = accessor.count ? (accessor.count - 1U) * byteStride + elementSize : 0U;
+
+                if (auto data = GetBinaryData(buffer, accessor.byteOffset + bufferView.byteOffset, byteLength))
+                {
+                    const uint8_t* dataPtr = data.get();
+                    view = AccessorView<T>(std::move(data), dataPtr, accessor.count, typeCount, byteStride);
+                    return true;
+                }
+
+                return false;
             }
 
-            template<typename T, typename I>
-            void ReadSparseBinaryData(const Document& gltfDocument, std::vector<T>& baseData, const Accessor& accessor) const
+            // Reads the sparse accessor's indices (widened to uint32_t) and its tightly packed values. Indices that
+            // are outside the range of the accessor's elements are discarded, along with their values.
+            template<typename T>
+            void ReadSparseData(const Document& gltfDocument, const Accessor& accessor, std::vector<uint32_t>& sparseIndices, std::vector<T>& sparseValues) const
             {
                 const auto typeCount = Accessor::GetTypeCount(accessor.type);
                 const auto elementSize = sizeof(T) * typeCount;
 
                 const size_t count = accessor.sparse.count;
 
-                const BufferView& indicesBufferView = gltfDocument.bufferViews.Get(accessor.sparse.indicesBufferViewId);
-                const Buffer& indicesBuffer = gltfDocument.buffers.Get(indicesBufferView.bufferId);
-                const size_t indicesOffset = accessor.sparse.indicesByteOffset + indicesBufferView.byteOffset;
+                switch (accessor.sparse.indicesComponentType)
+                {
+                case COMPONENT_UNSIGNED_BYTE:
+                    sparseIndices = ReadSparseIndices<uint8_t>(gltfDocument, accessor);
+                    break;
+                case COMPONENT_UNSIGNED_SHORT:
+                    sparseIndices = ReadSparseIndices<uint16_t>(gltfDocument, accessor);
+                    break;
+                case COMPONENT_UNSIGNED_INT:
+                    sparseIndices = ReadSparseIndices<uint32_t>(gltfDocument, accessor);
+                    break;
+                default:
+                    throw GLTFException("Unsupported sparse indices ComponentType");
+                }
 
                 const BufferView& valuesBufferView = gltfDocument.bufferViews.Get(accessor.sparse.valuesBufferViewId);
                 const Buffer& valuesBuffer = gltfDocument.buffers.Get(valuesBufferView.bufferId);
                 const size_t valuesOffset = accessor.sparse.valuesByteOffset + valuesBufferView.byteOffset;
 
-                std::vector<I> indices;
-
-                if (!indicesBufferView.byteStride || indicesBufferView.byteStride.Get() == sizeof(I))
+                if (!valuesBufferView.byteStride || valuesBufferView.byteStride.Get() == elementSize)
                 {
-                    indices = ReadBinaryData<I>(indicesBuffer, indicesOffset, count);
+                    sparseValues = ReadBinaryData<T>(valuesBuffer, valuesOffset, count * typeCount);
                 }
                 else
                 {
-                    indices = ReadBinaryDataInterleaved<I>(indicesBuffer, indicesOffset, count, 1U, indicesBufferView.byteStride.Get());
+                    sparseValues = ReadBinaryDataInterleaved<T>(valuesBuffer, valuesOffset, count, typeCount, valuesBufferView.byteStride.Get());
                 }
 
-                std::vector<T> values;
+                const size_t elementCount = accessor.count;
 
-                if (!valuesBufferView.byteStride || valuesBufferView.byteStride.Get() == elementSize)
-                {
-                    values = ReadBinaryData<T>(valuesBuffer, valuesOffset, count * typeCount);
-                }
-                else
-                {
-                    values = ReadBinaryDataInterleaved<T>(valuesBuffer, valuesOffset, count, typeCount, valuesBufferView.byteStride.Get());
-                }
+                auto isOutOfRange = [elementCount](uint32_t index) { return index >= elementCount; };
 
-                for (size_t i = 0; i < indices.size(); i++)
+                if (std::any_of(sparseIndices.begin(), sparseIndices.end(), isOutOfRange))
                 {
-                    assert(baseData.size() == accessor.count * typeCount);
-                    static_assert(sizeof(I) <= sizeof(size_t), "sizeof(I) < sizeof(size_t)");
-                    if (0 <= indices[i] && static_cast<size_t>(indices[i]) < accessor.count)
+                    size_t validCount = 0U;
+
+                    for (size_t i = 0U; i < sparseIndices.size(); ++i)
                     {
-                        for (size_t j = 0; j < typeCount; j++)
+                        if (!isOutOfRange(sparseIndices[i]))
                         {
-                            baseData[indices[i] * typeCount + j] = values[i * typeCount + j];
+                            sparseIndices[validCount] = sparseIndices[i];
+                            std::copy_n(sparseValues.begin() + i * typeCount, typeCount, sparseValues.begin() + validCount * typeCount);
+                            ++validCount;
                         }
                     }
+
+                    sparseIndices.resize(validCount);
+                    sparseValues.resize(validCount * typeCount);
+                }
+            }
+
+            template<typename I>
+            std::vector<uint32_t> ReadSparseIndices(const Document& gltfDocument, const Accessor& accessor) const
+            {
+                static_assert(sizeof(I) <= sizeof(uint32_t), "sizeof(I) <= sizeof(uint32_t)");
+
+                const size_t count = accessor.sparse.count;
+
+                const BufferView& indicesBufferView = gltfDocument.bufferViews.Get(accessor.sparse.indicesBufferViewId);
+                const Buffer& indicesBuffer = gltfDocument.buffers.Get(indicesBufferView.bufferId);
+                const size_t indicesOffset = accessor.sparse.indicesByteOffset + indicesBufferView.byteOffset;
+
+                std::vector<I> indices;
+
+                if (!indicesBufferView.byteStride || indicesBufferView.byteStride.Get() == sizeof(I))
+                {
+                    indices = ReadBinaryData<I>(indicesBuffer, indicesOffset, count);
+                }
+                else
+                {
+                    indices = ReadBinaryDataInterleaved<I>(indicesBuffer, indicesOffset, count, 1U, indicesBufferView.byteStride.Get());
                 }
+
+                return std::vector<uint32_t>(indices.begin(), indices.end());
             }
 
             std::unique_ptr<IStreamReaderCache> m_streamReaderCache;
+            // Guards m_streamReaderCache, the streams it returns, m_prefetchedRanges and m_prefetchedImages
+            std::unique_ptr<std::mutex> m_mutex;
+
+            std::shared_ptr<AccessorCache> m_accessorCache;
+            std::shared_ptr<BufferRangeCache> m_bufferRangeCache;
+            uint64_t m_bufferRangeCacheSourceId;
+            std::shared_ptr<IExecutor> m_executor;
+            std::shared_ptr<const IRandomAccessReader> m_randomAccessReader;
+
+            bool m_decodeDataUrisOnce;
+
+            // Prefetched buffer ranges, keyed by buffer id
+            mutable std::unordered_map<std::string, std::vector<PrefetchedRange>> m_prefetchedRanges;
+            // Prefetched external images, keyed by uri
+            mutable std::unordered_map<std::string, std::shared_ptr<const std::vector<uint8_t>>> m_prefetchedImages;
         };
     }
 }
@@ -0,0 +1,27 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // Positional (rather than seek then read) access to the resources referenced by a glTF document. Unlike
+        // the std::istream returned by IStreamReader::GetInputStream, a read doesn't depend on, or modify, any
+        // stream position so implementations must allow ReadAt and GetSize to be called concurrently.
+        class IRandomAccessReader
+        {
+        public:
+            virtual ~IRandomAccessReader() = default;
+
+            // Reads exactly byteLength bytes, starting at offset, into data. Throws if fewer bytes are available.
+            virtual void ReadAt(const std::string& uri, uint64_t offset, size_t byteLength, void* data) const = 0;
+            virtual uint64_t GetSize(const std::string& uri) const = 0;
+        };
+    }
+}
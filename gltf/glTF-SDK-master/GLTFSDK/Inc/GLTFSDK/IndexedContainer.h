@@ -5,6 +5,7 @@
 
 #include <GLTFSDK/Exceptions.h>
 
+#include <limits>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -27,6 +28,27 @@ namespace Microsoft
             GenerateOnEmpty
         };
 
+        // An index based reference to an element of an IndexedContainer. Resolving a handle is an array access -
+        // there is no hashing or string comparison as there is when resolving an id. Handles are invalidated when
+        // an element is removed from the container.
+        template<typename T>
+        struct Handle
+        {
+            size_t index;
+        };
+
+        template<typename T>
+        bool operator==(const Handle<T>& lhs, const Handle<T>& rhs)
+        {
+            return lhs.index == rhs.index;
+        }
+
+        template<typename T>
+        bool operator!=(const Handle<T>& lhs, const Handle<T>& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
         template<typename T, bool = std::is_const<T>::value>
         class IndexedContainer;
 
@@ -60,6 +82,11 @@ namespace Microsoft
                 return operator[](GetIndex(key));
             }
 
+            const T& operator[](Handle<T> handle) const
+            {
+                return operator[](handle.index);
+            }
+
             bool operator==(const IndexedContainer& rhs) const
             {
                 return (m_elements == rhs.m_elements);
@@ -128,6 +155,16 @@ namespace Microsoft
                 return operator[](key);
             }
 
+            const T& Get(Handle<T> handle) const
+            {
+                return operator[](handle);
+            }
+
+            Handle<T> GetHandle(const std::string& key) const
+            {
+                return { GetIndex(key) };
+            }
+
             size_t GetIndex(const std::string& key) const
             {
                 if (key.empty())
@@ -135,6 +172,13 @@ namespace Microsoft
                     throw GLTFException("Invalid key - cannot be empty");
                 }
 
+                size_t index;
+
+                if (TryGetGeneratedIndex(key, index))
+                {
+                    return index;
+                }
+
                 auto it = m_elementIndices.find(key);
 
                 if (it == m_elementIndices.end())
@@ -147,7 +191,8 @@ namespace Microsoft
 
             bool Has(const std::string& key) const
             {
-                return m_elementIndices.find(key) != m_elementIndices.end();
+                size_t index;
+                return TryGetGeneratedIndex(key, index) || m_elementIndices.find(key) != m_elementIndices.end();
             }
 
             void Remove(const std::string& key)
@@ -189,6 +234,30 @@ namespace Microsoft
             }
 
         private:
+            // Ids generated by Append (and so all ids of a deserialized document) are the element's index. If the key
+            // is a decimal number and the element at that index has the key as its id then no hash lookup is needed.
+            bool TryGetGeneratedIndex(const std::string& key, size_t& index) const
+            {
+                if (key.empty() || key.size() > static_cast<size_t>(std::numeric_limits<size_t>::digits10))
+                {
+                    return false;
+                }
+
+                index = 0U;
+
+                for (char c : key)
+                {
+                    if (c < '0' || c > '9')
+                    {
+                        return false;
+                    }
+
+                    index = index * 10U + static_cast<size_t>(c - '0');
+                }
+
+                return index < m_elements.size() && m_elements[index].id == key;
+            }
+
             std::vector<T> m_elements;
             std::unordered_map<std::string, size_t> m_elementIndices;
         };
@@ -221,6 +290,11 @@ namespace Microsoft
                 return operator[](GetIndex(key));
             }
 
+            T& operator[](Handle<T> handle)
+            {
+                return operator[](handle.index);
+            }
+
             bool operator==(const IndexedContainer& rhs) const
             {
                 return IndexedContainer<const T>::operator==(rhs);
@@ -256,6 +330,11 @@ namespace Microsoft
                 return operator[](key);
             }
 
+            T& Get(Handle<T> handle)
+            {
+                return operator[](handle);
+            }
+
             // No using declaration for Append, operator== or operator!= as we don't
             // want to make the base class versions of these functions publically
             // accessible (the mutable versions replace rather than complement them)
@@ -264,6 +343,7 @@ namespace Microsoft
             using IndexedContainer<const T>::Clear;
             using IndexedContainer<const T>::Elements;
             using IndexedContainer<const T>::Get;
+            using IndexedContainer<const T>::GetHandle;
             using IndexedContainer<const T>::GetIndex;
             using IndexedContainer<const T>::Has;
             using IndexedContainer<const T>::Remove;
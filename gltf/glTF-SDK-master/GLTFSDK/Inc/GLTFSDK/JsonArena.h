@@ -0,0 +1,88 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/RapidJsonUtils.h>
+
+#include <memory>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // Reusable storage for the JSON DOMs (and serialized output) built by Deserialize and Serialize. Batch jobs that
+        // process many manifests back to back can pass the same arena to each call: its memory is reset, rather than
+        // freed, between documents and grows to fit the largest DOM seen so subsequent documents of a similar size are
+        // built without requesting any more memory from the system. An arena isn't thread safe - use one per thread.
+        class JsonArena
+        {
+        public:
+            static constexpr size_t DefaultCapacity = 64U * 1024U;
+            static constexpr size_t StackCapacity = 1024U;
+
+            // Smaller capacities are rounded up to this. It is a conservative floor, well above the bookkeeping that
+            // rapidjson's pool allocator stores at the start of the buffer, rather than that bookkeeping's exact size.
+            static constexpr size_t MinimumCapacity = 1024U;
+
+            // A rapidjson allocator that counts the allocations it makes against the arena (see GetAllocationCount)
+            class CountingAllocator
+            {
+            public:
+                static const bool kNeedFree = true;
+
+                explicit CountingAllocator(size_t* allocationCount = nullptr);
+
+                void* Malloc(size_t size);
+                void* Realloc(void* originalPtr, size_t originalSize, size_t newSize);
+                static void Free(void* ptr);
+
+            private:
+                rapidjson::CrtAllocator m_allocator;
+                size_t* m_allocationCount;
+            };
+
+            // A DOM whose values are allocated from the arena's pool and whose parse stack uses its counting allocator
+            typedef rapidjson::GenericDocument<rapidjson::UTF8<>, rapidjson::MemoryPoolAllocator<>, CountingAllocator> JsonDocument;
+            typedef rapidjson::GenericStringBuffer<rapidjson::UTF8<>, CountingAllocator> StringBuffer;
+
+            explicit JsonArena(size_t capacity = DefaultCapacity);
+
+            JsonArena(const JsonArena&) = delete;
+            JsonArena& operator=(const JsonArena&) = delete;
+
+            // Discards every value allocated from the arena. If they didn't fit in the arena's buffer it is enlarged.
+            void Reset();
+
+            rapidjson::MemoryPoolAllocator<>& GetAllocator();
+            CountingAllocator& GetStackAllocator();
+            StringBuffer& GetStringBuffer();
+
+            size_t GetCapacity() const;
+
+            // The number of heap allocations made on behalf of the arena: allocations of its buffer, of the parse
+            // stack and of the string buffer's growth, plus the chunks the pool adds once the buffer is exhausted.
+            // The SDK's rapidjson::Value type fixes the pool's base allocator as rapidjson::CrtAllocator, so those
+            // chunks can't be counted as they are allocated. Instead each DefaultCapacity (the pool's chunk size) by
+            // which the pool has grown beyond the buffer is counted as one allocation.
+            size_t GetAllocationCount() const;
+
+        private:
+            void Allocate(size_t capacity);
+
+            // The number of chunks the pool has added since it was last cleared
+            size_t GetChunkCount() const;
+
+            size_t m_allocationCount;
+            CountingAllocator m_baseAllocator;
+
+            std::unique_ptr<char[]> m_buffer;
+            size_t m_capacity;
+            size_t m_poolCapacity; // The capacity of the buffer available for values (excluding the pool's bookkeeping)
+
+            rapidjson::CrtAllocator m_chunkAllocator;
+            std::unique_ptr<rapidjson::MemoryPoolAllocator<>> m_allocator;
+            StringBuffer m_stringBuffer;
+        };
+    }
+}
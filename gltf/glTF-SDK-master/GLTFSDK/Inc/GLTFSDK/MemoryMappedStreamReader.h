@@ -0,0 +1,51 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/IStreamReader.h>
+#include <GLTFSDK/MemoryStream.h>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // A read-only mapping of a file's entire contents into the address space of the process
+        class MemoryMappedFile
+        {
+        public:
+            explicit MemoryMappedFile(const std::string& path);
+            ~MemoryMappedFile();
+
+            MemoryMappedFile(const MemoryMappedFile&) = delete;
+            MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+            const uint8_t* Data() const;
+            size_t Size() const;
+
+        private:
+            const uint8_t* m_data;
+            size_t         m_size;
+
+#ifdef _WIN32
+            void* m_file;
+            void* m_mapping;
+#endif
+        };
+
+        // An IStreamReader that memory maps the requested files. The streams returned by GetInputStream
+        // are MemoryStreams so GLTFResourceReader::ReadAccessorView can return views directly into the
+        // mapped file (for both .bin and .glb files) rather than copying the accessor data
+        class MemoryMappedStreamReader : public IStreamReader
+        {
+        public:
+            explicit MemoryMappedStreamReader(std::string pathBase = {});
+
+            // The returned stream is always a MemoryStream
+            std::shared_ptr<std::istream> GetInputStream(const std::string& uri) const override;
+
+        private:
+            std::string m_pathBase;
+        };
+    }
+}
@@ -0,0 +1,112 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <streambuf>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // An input stream over a contiguous, immutable block of memory (e.g. a memory mapped file). The
+        // owner parameter keeps the memory alive for as long as the stream, or any view of its data, exists.
+        //
+        // Note: GLTFResourceReader checks whether the streams it is given are MemoryStreams and, if they
+        // are, reads directly from Data() rather than copying the data via the std::istream interface
+        class MemoryStream : public std::istream
+        {
+        public:
+            MemoryStream(std::shared_ptr<const void> owner, const uint8_t* data, size_t size) :
+                std::istream(nullptr),
+                m_owner(std::move(owner)),
+                m_streamBuf(data, size)
+            {
+                rdbuf(&m_streamBuf);
+            }
+
+            const uint8_t* Data() const
+            {
+                return m_streamBuf.Data();
+            }
+
+            size_t Size() const
+            {
+                return m_streamBuf.Size();
+            }
+
+        private:
+            class MemoryStreamBuf : public std::streambuf
+            {
+            public:
+                MemoryStreamBuf(const uint8_t* data, size_t size) : m_data(data), m_size(size)
+                {
+                    // The get area is never written to so casting away const is safe
+                    char* begin = reinterpret_cast<char*>(const_cast<uint8_t*>(data));
+                    setg(begin, begin, begin + size);
+                }
+
+                const uint8_t* Data() const
+                {
+                    return m_data;
+                }
+
+                size_t Size() const
+                {
+                    return m_size;
+                }
+
+            protected:
+                pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+                {
+                    if ((which & std::ios_base::in) == 0)
+                    {
+                        return pos_type(off_type(-1));
+                    }
+
+                    off_type base;
+
+                    switch (dir)
+                    {
+                    case std::ios_base::beg:
+                        base = 0;
+                        break;
+                    case std::ios_base::cur:
+                        base = gptr() - eback();
+                        break;
+                    case std::ios_base::end:
+                        base = static_cast<off_type>(m_size);
+                        break;
+                    default:
+                        return pos_type(off_type(-1));
+                    }
+
+                    const off_type pos = base + off;
+
+                    if (pos < 0 || pos > static_cast<off_type>(m_size))
+                    {
+                        return pos_type(off_type(-1));
+                    }
+
+                    setg(eback(), eback() + pos, egptr());
+                    return pos_type(pos);
+                }
+
+                pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+                {
+                    return seekoff(off_type(pos), std::ios_base::beg, which);
+                }
+
+            private:
+                const uint8_t* const m_data;
+                const size_t         m_size;
+            };
+
+            std::shared_ptr<const void> m_owner;
+            MemoryStreamBuf             m_streamBuf;
+        };
+    }
+}
@@ -16,6 +16,25 @@ namespace Microsoft
 
         namespace MeshPrimitiveUtils
         {
+            // The data of a mesh primitive's indices and common vertex attributes, as returned by ReadPrimitive.
+            // The vectors of any attributes the mesh primitive doesn't have are left empty
+            struct MeshPrimitiveData
+            {
+                std::vector<uint32_t> indices;
+                std::vector<float> positions;
+                std::vector<float> normals;
+                std::vector<float> tangents;
+                std::vector<float> texCoords0;
+                std::vector<float> texCoords1;
+                std::vector<uint32_t> colors0;
+                std::vector<uint64_t> jointIndices0;
+                std::vector<uint32_t> jointWeights0;
+            };
+
+            // Reads all of a mesh primitive's indices and attributes using a single ReadPlan, i.e. with one
+            // sequential read per (merged) buffer range, rather than an independent read per accessor
+            MeshPrimitiveData ReadPrimitive(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive);
+
             std::vector<uint16_t> GetIndices16(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor);
             std::vector<uint16_t> GetIndices16(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive);
 
@@ -57,6 +76,33 @@ namespace Microsoft
             std::vector<uint32_t> GetJointWeights32(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor);
             std::vector<uint32_t> GetJointWeights32_0(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive);
 
+            // The following overloads write into a caller provided buffer with space for 'capacity' values, rather than
+            // returning a new vector, and return the number of values written. They throw if the buffer is too small.
+            // Data that doesn't require conversion (e.g. float positions or 32-bit indices read by GetIndices32) is
+            // read directly into the buffer, without allocating any memory.
+            size_t GetIndices16(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, uint16_t* data, size_t capacity);
+            size_t GetIndices16(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, uint16_t* data, size_t capacity);
+
+            size_t GetIndices32(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, uint32_t* data, size_t capacity);
+            size_t GetIndices32(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, uint32_t* data, size_t capacity);
+
+            size_t GetPositions(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, float* data, size_t capacity);
+            size_t GetPositions(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, float* data, size_t capacity);
+            size_t GetPositions(const Document& doc, const GLTFResourceReader& reader, const MorphTarget& morphTarget, float* data, size_t capacity);
+
+            size_t GetNormals(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, float* data, size_t capacity);
+            size_t GetNormals(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, float* data, size_t capacity);
+            size_t GetNormals(const Document& doc, const GLTFResourceReader& reader, const MorphTarget& morphTarget, float* data, size_t capacity);
+
+            size_t GetTangents(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, float* data, size_t capacity);
+            size_t GetTangents(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, float* data, size_t capacity);
+            size_t GetTangents(const Document& doc, const GLTFResourceReader& reader, const MorphTarget& morphTarget, float* data, size_t capacity);
+            size_t GetMorphTangents(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, float* data, size_t capacity);
+
+            size_t GetTexCoords(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, float* data, size_t capacity);
+            size_t GetTexCoords_0(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, float* data, size_t capacity);
+            size_t GetTexCoords_1(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, float* data, size_t capacity);
+
             std::vector<uint16_t> ReverseTriangulateIndices16(const uint16_t* indices, size_t indexCount, MeshMode mode);
             std::vector<uint32_t> ReverseTriangulateIndices32(const uint32_t* indices, size_t indexCount, MeshMode mode);
 
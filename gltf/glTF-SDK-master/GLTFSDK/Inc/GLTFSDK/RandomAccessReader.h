@@ -0,0 +1,88 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/IRandomAccessReader.h>
+#include <GLTFSDK/IStreamReader.h>
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // A read-only file supporting concurrent positional reads (pread on POSIX, ReadFile with an explicit
+        // offset on Windows) - no file position is shared between reads
+        class RandomAccessFile
+        {
+        public:
+            explicit RandomAccessFile(const std::string& path);
+            ~RandomAccessFile();
+
+            RandomAccessFile(const RandomAccessFile&) = delete;
+            RandomAccessFile& operator=(const RandomAccessFile&) = delete;
+
+            void ReadAt(uint64_t offset, size_t byteLength, void* data) const;
+            uint64_t Size() const;
+
+        private:
+            std::string m_path;
+            uint64_t    m_size;
+
+#ifdef _WIN32
+            void* m_file;
+#else
+            int m_file;
+#endif
+        };
+
+        // An IRandomAccessReader that opens each requested file once and keeps it open for the lifetime of the
+        // reader. Reads are performed without holding any lock.
+        class FileRandomAccessReader : public IRandomAccessReader
+        {
+        public:
+            explicit FileRandomAccessReader(std::string pathBase = {});
+
+            void ReadAt(const std::string& uri, uint64_t offset, size_t byteLength, void* data) const override;
+            uint64_t GetSize(const std::string& uri) const override;
+
+        private:
+            std::shared_ptr<const RandomAccessFile> GetFile(const std::string& uri) const;
+
+            std::string m_pathBase;
+
+            mutable std::mutex m_mutex;
+            mutable std::unordered_map<std::string, std::shared_ptr<const RandomAccessFile>> m_files;
+        };
+
+        // Adapts an IStreamReader to the IRandomAccessReader interface. Each uri's stream is requested once and
+        // retained. Reads of a std::istream are serialized per stream (each is a seekg followed by a read) while
+        // reads of a MemoryStream (e.g. from MemoryMappedStreamReader) copy directly from its data without a lock.
+        class StreamRandomAccessReader : public IRandomAccessReader
+        {
+        public:
+            explicit StreamRandomAccessReader(std::shared_ptr<const IStreamReader> streamReader);
+
+            void ReadAt(const std::string& uri, uint64_t offset, size_t byteLength, void* data) const override;
+            uint64_t GetSize(const std::string& uri) const override;
+
+        private:
+            struct StreamEntry
+            {
+                std::shared_ptr<std::istream> stream;
+                uint64_t size;
+                std::mutex mutex;
+            };
+
+            std::shared_ptr<StreamEntry> GetStreamEntry(const std::string& uri) const;
+
+            std::shared_ptr<const IStreamReader> m_streamReader;
+
+            mutable std::mutex m_mutex;
+            mutable std::unordered_map<std::string, std::shared_ptr<StreamEntry>> m_streams;
+        };
+    }
+}
@@ -55,6 +55,12 @@ namespace Microsoft
         typedef std::conditional<IsUnsignedLongSizeofUInt32, uint32_t, uint64_t>::type UnsignedLongKnownSizeType;
         typedef std::conditional<std::is_same<std::size_t, unsigned long>::value, UnsignedLongKnownSizeType, std::size_t>::type KnownSizeType;
 
+        // A view of a JSON value in a parsed document, passed to handlers added with ExtensionDeserializer::AddValueHandler
+        struct JsonValue
+        {
+            const rapidjson::Value& value;
+        };
+
         template<typename T>
         std::string GetMemberValueAsString(const rapidjson::Value& v, const char* memberName)
         {
@@ -359,6 +365,21 @@ namespace Microsoft
                 return document;
             }
 
+            // Parses the null terminated json in situ, the document's strings reference (and the parse modifies)
+            // the json buffer rather than being copied. The buffer must outlive the returned document.
+            inline rapidjson::Document CreateDocumentFromInsituString(char* json)
+            {
+                rapidjson::Document document;
+
+                if (document.ParseInsitu(json).HasParseError())
+                {
+                    // The input is not valid JSON.
+                    throw GLTFException("The document is invalid due to bad JSON formatting");
+                }
+
+                return document;
+            }
+
             inline rapidjson::Document CreateDocumentFromEncodedString(const std::string& json)
             {
                 rapidjson::MemoryStream memoryStream(json.c_str(), json.size());
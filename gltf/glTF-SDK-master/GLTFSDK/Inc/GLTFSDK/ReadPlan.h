@@ -0,0 +1,80 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/GLTF.h>
+#include <GLTFSDK/Traverse.h>
+
+#include <string>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        class Document;
+
+        struct BufferRange
+        {
+            std::string bufferId;
+            size_t byteOffset;
+            size_t byteLength;
+
+            bool operator==(const BufferRange& rhs) const
+            {
+                return this->bufferId == rhs.bufferId
+                    && this->byteOffset == rhs.byteOffset
+                    && this->byteLength == rhs.byteLength;
+            }
+
+            bool operator!=(const BufferRange& rhs) const
+            {
+                return !operator==(rhs);
+            }
+        };
+
+        // Collects the buffer byte ranges referenced by a set of accessors (e.g. all the attributes of a
+        // mesh primitive) so they can be read with a minimal number of large sequential reads. Pass the
+        // plan to GLTFResourceReader::Prefetch, subsequent reads of the planned accessors are then served
+        // from memory rather than each requiring their own stream round-trip.
+        //
+        // AddScene plans everything a scene's nodes reference (mesh primitives, skins and images), so all the
+        // data needed to render or convert the scene can be read ahead, in buffer offset order, before any of
+        // it is decoded.
+        class ReadPlan
+        {
+        public:
+            // Ranges in the same buffer separated by at most maxGapByteLength bytes are merged, so a
+            // single read may include a small number of unused bytes rather than requiring an extra seek
+            explicit ReadPlan(size_t maxGapByteLength = 0U);
+
+            void AddBufferRange(const std::string& bufferId, size_t byteOffset, size_t byteLength);
+
+            void AddBufferView(const BufferView& bufferView);
+            void AddAccessor(const Document& document, const Accessor& accessor);
+            void AddMeshPrimitive(const Document& document, const MeshPrimitive& meshPrimitive);
+            void AddMesh(const Document& document, const Mesh& mesh);
+            void AddSkin(const Document& document, const Skin& skin);
+            // Images stored in a buffer view add the buffer view's range. Images with an external uri add
+            // the uri (see GetImageUris) and base64 data uris, which are already in memory, are ignored.
+            void AddImage(const Document& document, const Image& image);
+
+            // Adds the mesh primitives, skins and images referenced by the nodes of the scene (or the document's
+            // default scene). Each mesh, skin and image is only added once, however many nodes reference it.
+            void AddScene(const Document& document, size_t sceneIndex = DefaultSceneIndex);
+
+            // Returns the merged ranges, ordered by buffer id and then by byte offset
+            std::vector<BufferRange> GetBufferRanges() const;
+            // Returns the distinct external image uris, in the order they were added
+            const std::vector<std::string>& GetImageUris() const;
+
+            bool IsEmpty() const;
+
+        private:
+            size_t m_maxGapByteLength;
+            std::vector<BufferRange> m_bufferRanges;
+            std::vector<std::string> m_imageUris;
+        };
+    }
+}
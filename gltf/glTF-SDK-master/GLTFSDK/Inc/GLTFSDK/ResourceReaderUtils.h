@@ -8,6 +8,8 @@
 #include <string>
 #include <vector>
 #include <cmath>
+#include <limits>
+#include <type_traits>
 
 namespace Microsoft
 {
@@ -108,65 +110,10 @@ namespace Microsoft
             return decodeTable;
         }
 
-        inline void Base64Decode(Base64StringView encodedData, Base64BufferView decodedData, size_t bytesToSkip)
-        {
-            if (encodedData.GetByteCount() != (decodedData.bufferByteLength + bytesToSkip))
-            {
-                throw GLTFException("The specified decode buffer's size is incorrect");
-            }
-
-            static const std::vector<uint8_t> decodeTable = GetDecodeTable();
-
-            uint32_t block = 0U;
-            uint32_t blockBits = 0U;
-
-            uint8_t* decodedBytePtr = static_cast<uint8_t*>(decodedData.buffer);
-
-            for (const auto encodedChar : encodedData)
-            {
-                // For platforms where char is unsigned (encodedChar < 0) results in a tautology warning.
-                // Only do that test on platforms where char is signed.
-                if ((std::numeric_limits<char>::is_signed && (static_cast<signed char>(encodedChar) < 0)) || (static_cast<size_t>(encodedChar) >= decodeTable.size()))
-                {
-                    throw GLTFException("Invalid base64 character");
-                }
-
-                const auto decodedChar = decodeTable[encodedChar];
-
-                if (decodedChar == std::numeric_limits<uint8_t>::max())
-                {
-                    throw GLTFException("Invalid base64 character");
-                }
-
-                // Each character of a base64 string encodes 6 bits of data so left shift any remaining
-                // bits to accomodate another character's worth of data before performing a bitwise OR
-                block <<= 6U;
-                block |= decodedChar & 0x3F;
-
-                // Keep track of how many bits of the 'block' variable are currently used
-                blockBits += 6U;
-
-                // If there are 8 or more bits stored in 'block' then write a single byte to the output buffer
-                if (blockBits >= 8U)
-                {
-                    blockBits -= 8U;
-
-                    if (bytesToSkip > 0)
-                    {
-                        bytesToSkip--;
-                    }
-                    else
-                    {
-                        // Right shift the decoded data stored in 'block' so that the byte of
-                        // data to be written to the output buffer occupies the low-order byte
-                        *(decodedBytePtr++) = (block >> blockBits) & 0xFF;
-                    }
-
-                    // Generate a bitmask that discards only the byte just written to the output buffer during the bitwise AND
-                    block &= (1 << blockBits) - 1;
-                }
-            }
-        }
+        // Decodes the base64 encoded data into the decode buffer, discarding the first bytesToSkip decoded bytes.
+        // The decode buffer must be exactly large enough for the remaining bytes. Uses an SSSE3 implementation,
+        // when supported by the CPU, that decodes 16 characters at a time.
+        void Base64Decode(Base64StringView encodedData, Base64BufferView decodedData, size_t bytesToSkip);
 
         inline std::vector<uint8_t> Base64Decode(const Base64StringView& encodedData)
         {
@@ -235,5 +182,20 @@ namespace Microsoft
         template<> inline uint8_t  FloatToComponent<uint8_t>(const float f) { return static_cast<uint8_t>(std::round(f*255.0f)); }
         template<> inline int16_t  FloatToComponent<int16_t>(const float f) { return static_cast<int16_t>(std::round(f*32767.0f)); }
         template<> inline uint16_t FloatToComponent<uint16_t>(const float f){ return static_cast<uint16_t>(std::round(f*65535.0f)); }
+
+        // Batch conversions of count normalized components to floats, producing the same results as calling
+        // ComponentToFloat for each component. Uses SSE2, where available, to convert multiple components at once.
+        void ComponentsToFloats(const int8_t* components, size_t count, float* floats);
+        void ComponentsToFloats(const uint8_t* components, size_t count, float* floats);
+        void ComponentsToFloats(const int16_t* components, size_t count, float* floats);
+        void ComponentsToFloats(const uint16_t* components, size_t count, float* floats);
+
+        // Batch conversions of count floats to normalized components, producing the same results as calling
+        // FloatToComponent for each float. Floats outside the normalized range ([-1,1] for signed component
+        // types and [0,1] for unsigned) are clamped to it first. Uses SSE2, where available.
+        void FloatsToComponents(const float* floats, size_t count, int8_t* components);
+        void FloatsToComponents(const float* floats, size_t count, uint8_t* components);
+        void FloatsToComponents(const float* floats, size_t count, int16_t* components);
+        void FloatsToComponents(const float* floats, size_t count, uint16_t* components);
     }
 }
@@ -1,9 +1,15 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#pragma once
+
+#include <GLTFSDK/Exceptions.h>
 #include <GLTFSDK/RapidJsonUtils.h>
+#include <GLTFSDK/Schema.h>
 
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 
 namespace Microsoft
 {
@@ -16,6 +22,44 @@ namespace Microsoft
             virtual const char* GetSchemaContent(const std::string& uri) const = 0;
         };
 
-        void ValidateDocumentAgainstSchema(const rapidjson::Document& d, const std::string& schemaUri, std::unique_ptr<const ISchemaLocator> schemaLocator);
+        // A thread safe registry of compiled schemas. Each schema is parsed and compiled the first time it is requested
+        // and the resulting SchemaDocument is reused by every subsequent validation. A compiled schema is immutable so
+        // any number of validators may use it concurrently.
+        class SchemaCache
+        {
+        public:
+            explicit SchemaCache(std::unique_ptr<const ISchemaLocator> schemaLocator);
+
+            SchemaCache(const SchemaCache&) = delete;
+            SchemaCache& operator=(const SchemaCache&) = delete;
+
+            const rapidjson::SchemaDocument& GetSchemaDocument(const std::string& uri) const;
+
+        private:
+            const std::unique_ptr<const ISchemaLocator> m_schemaLocator;
+
+            mutable std::mutex m_mutex;
+            mutable std::unordered_map<std::string, rapidjson::SchemaDocument> m_schemaDocuments;
+        };
+
+        // Returns the process wide cache of the schemas provided by GetDefaultSchemaLocator for the specified flags
+        std::shared_ptr<const SchemaCache> GetDefaultSchemaCache(SchemaFlags schemaFlags);
+
+        void ValidateDocumentAgainstSchema(const rapidjson::Value& d, const std::string& schemaUri, std::unique_ptr<const ISchemaLocator> schemaLocator);
+        void ValidateDocumentAgainstSchema(const rapidjson::Value& d, const std::string& schemaUri, const SchemaCache& schemaCache);
+
+        // Throws a ValidationException describing the first violation found by a schema validator. Used both when
+        // validating a DOM and when validating SAX events as they are parsed.
+        template<typename TSchemaValidator>
+        void ThrowSchemaViolation(TSchemaValidator& schemaValidator)
+        {
+            rapidjson::StringBuffer sb;
+
+            const std::string schemaKeyword = schemaValidator.GetInvalidSchemaKeyword();
+            schemaValidator.GetInvalidDocumentPointer().StringifyUriFragment(sb);
+            const std::string schemaInvalid = sb.GetString();
+
+            throw ValidationException("Schema violation at " + schemaInvalid + " due to " + schemaKeyword);
+        }
     }
 }
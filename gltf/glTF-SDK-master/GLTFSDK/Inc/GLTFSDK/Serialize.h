@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <iosfwd>
 #include <string>
 
 namespace Microsoft 
@@ -22,8 +23,23 @@ namespace Microsoft
 
         class Document;
         class ExtensionSerializer;
+        class JsonArena;
 
         std::string Serialize(const Document& gltfDocument, SerializeFlags flags = SerializeFlags::None);
         std::string Serialize(const Document& gltfDocument, const ExtensionSerializer& extensionHandler, SerializeFlags flags = SerializeFlags::None);
+
+        // The DOM and the serialized json are built in the arena (which is reset first) so a batch of documents can be
+        // serialized reusing the same memory
+        std::string Serialize(const Document& gltfDocument, JsonArena& arena, SerializeFlags flags = SerializeFlags::None);
+        std::string Serialize(const Document& gltfDocument, JsonArena& arena, const ExtensionSerializer& extensionHandler, SerializeFlags flags = SerializeFlags::None);
+
+        // The json is written to the stream as it is generated without building a DOM or string for the whole document,
+        // only one top level property (or one element of a top level array) is held in memory at a time. If an exception
+        // is thrown the stream will contain a partially written document
+        void Serialize(const Document& gltfDocument, std::ostream& stream, SerializeFlags flags = SerializeFlags::None);
+        void Serialize(const Document& gltfDocument, std::ostream& stream, const ExtensionSerializer& extensionHandler, SerializeFlags flags = SerializeFlags::None);
+
+        // Returns the length in bytes of the json that Serialize would write, without storing it
+        size_t GetSerializedLength(const Document& gltfDocument, const ExtensionSerializer& extensionHandler, SerializeFlags flags = SerializeFlags::None);
     }
 }
@@ -0,0 +1,219 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/AccessorView.h>
+#include <GLTFSDK/Deinterleave.h>
+#include <GLTFSDK/Exceptions.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // A read-only view of a sparse accessor's elements that overlays the accessor's sparse values on its
+        // base data without combining them into a dense array. The base data is an AccessorView or, for sparse
+        // accessors without a bufferView, implicitly all zeros. Elements are looked up in the (sorted) sparse
+        // indices before falling back to the base data.
+        //
+        // Views returned by GLTFResourceReader::ReadSparseAccessorView only allocate memory for the sparse
+        // indices and values (plus the base data if its buffer isn't in memory, see ReadAccessorView).
+        template<typename T>
+        class SparseAccessorView
+        {
+        public:
+            SparseAccessorView() : m_hasBaseView(false), m_elementCount(0U), m_typeCount(0U)
+            {
+            }
+
+            // Constructs a view of an accessor without any sparse values
+            explicit SparseAccessorView(AccessorView<T> baseView) :
+                m_baseView(std::move(baseView)),
+                m_hasBaseView(true),
+                m_elementCount(m_baseView.GetElementCount()),
+                m_typeCount(m_baseView.GetTypeCount())
+            {
+            }
+
+            // Constructs a view that overlays the tightly packed sparse values (typeCount components per index) on
+            // the base view. If hasBaseView is false the base data is all zeros. Indices need not be sorted but
+            // they must all be less than elementCount.
+            SparseAccessorView(AccessorView<T> baseView, bool hasBaseView, size_t elementCount, size_t typeCount, std::vector<uint32_t> sparseIndices, std::vector<T> sparseValues) :
+                m_baseView(std::move(baseView)),
+                m_hasBaseView(hasBaseView),
+                m_elementCount(elementCount),
+                m_typeCount(typeCount),
+                m_sparseIndices(std::move(sparseIndices)),
+                m_sparseValues(std::move(sparseValues))
+            {
+                if (m_sparseValues.size() != m_sparseIndices.size() * m_typeCount)
+                {
+                    throw GLTFException("SparseAccessorView requires typeCount values per sparse index");
+                }
+
+                if (m_hasBaseView && (m_baseView.GetElementCount() != m_elementCount || m_baseView.GetTypeCount() != m_typeCount))
+                {
+                    throw GLTFException("SparseAccessorView base view doesn't match the view's dimensions");
+                }
+
+                if (std::any_of(m_sparseIndices.begin(), m_sparseIndices.end(), [elementCount](uint32_t index) { return index >= elementCount; }))
+                {
+                    throw GLTFException("SparseAccessorView sparse index is outside the range of the view's elements");
+                }
+
+                // The glTF specification requires strictly increasing indices, so this is rarely necessary
+                if (!std::is_sorted(m_sparseIndices.begin(), m_sparseIndices.end()))
+                {
+                    SortSparseValues();
+                }
+            }
+
+            size_t GetElementCount() const
+            {
+                return m_elementCount;
+            }
+
+            size_t GetTypeCount() const
+            {
+                return m_typeCount;
+            }
+
+            size_t GetComponentCount() const
+            {
+                return m_elementCount * m_typeCount;
+            }
+
+            bool HasBaseView() const
+            {
+                return m_hasBaseView;
+            }
+
+            const AccessorView<T>& GetBaseView() const
+            {
+                return m_baseView;
+            }
+
+            size_t GetSparseCount() const
+            {
+                return m_sparseIndices.size();
+            }
+
+            // The element indices of the sparse values, in ascending order
+            const std::vector<uint32_t>& GetSparseIndices() const
+            {
+                return m_sparseIndices;
+            }
+
+            // The sparse values, typeCount components per sparse index
+            const std::vector<T>& GetSparseValues() const
+            {
+                return m_sparseValues;
+            }
+
+            // Returns a pointer to the element's sparse value, or nullptr if the element isn't sparse
+            const T* FindSparseElement(size_t elementIndex) const
+            {
+                // Use the last of any repeated indices, consistent with densifying the view
+                auto it = std::upper_bound(m_sparseIndices.begin(), m_sparseIndices.end(), elementIndex);
+
+                if (it == m_sparseIndices.begin() || *(it - 1) != elementIndex)
+                {
+                    return nullptr;
+                }
+
+                return m_sparseValues.data() + (std::distance(m_sparseIndices.begin(), it) - 1) * m_typeCount;
+            }
+
+            T Get(size_t elementIndex, size_t componentIndex) const
+            {
+                if (const T* element = FindSparseElement(elementIndex))
+                {
+                    return element[componentIndex];
+                }
+
+                return m_hasBaseView ? m_baseView.Get(elementIndex, componentIndex) : T();
+            }
+
+            // Copies the element's GetTypeCount() components into the specified array
+            void GetElement(size_t elementIndex, T* element) const
+            {
+                if (const T* sparseElement = FindSparseElement(elementIndex))
+                {
+                    std::copy(sparseElement, sparseElement + m_typeCount, element);
+                }
+                else if (m_hasBaseView)
+                {
+                    std::memcpy(element, m_baseView.GetElement(elementIndex), sizeof(T) * m_typeCount);
+                }
+                else
+                {
+                    std::fill(element, element + m_typeCount, T());
+                }
+            }
+
+            // Densifies the view, copying the base data and then the sparse values into an array with space for
+            // GetComponentCount() components
+            void CopyTo(T* data) const
+            {
+                if (!m_hasBaseView)
+                {
+                    std::fill(data, data + GetComponentCount(), T());
+                }
+                else if (m_elementCount > 0U)
+                {
+                    Deinterleave(m_baseView.GetElement(0U), m_baseView.GetByteStride(), m_elementCount, sizeof(T) * m_typeCount, data);
+                }
+
+                Scatter(m_sparseValues.data(), m_sparseIndices.data(), m_sparseIndices.size(), sizeof(T) * m_typeCount, data);
+            }
+
+            // Densifies the view into a new, tightly packed, vector
+            std::vector<T> ToVector() const
+            {
+                std::vector<T> data(GetComponentCount());
+                CopyTo(data.data());
+                return data;
+            }
+
+        private:
+            void SortSparseValues()
+            {
+                std::vector<size_t> order(m_sparseIndices.size());
+                std::iota(order.begin(), order.end(), size_t(0U));
+
+                // A stable sort preserves the order of any repeated indices' values
+                std::stable_sort(order.begin(), order.end(), [this](size_t lhs, size_t rhs)
+                {
+                    return m_sparseIndices[lhs] < m_sparseIndices[rhs];
+                });
+
+                std::vector<uint32_t> sortedIndices(m_sparseIndices.size());
+                std::vector<T> sortedValues(m_sparseValues.size());
+
+                for (size_t i = 0U; i < order.size(); ++i)
+                {
+                    sortedIndices[i] = m_sparseIndices[order[i]];
+                    std::copy_n(m_sparseValues.begin() + order[i] * m_typeCount, m_typeCount, sortedValues.begin() + i * m_typeCount);
+                }
+
+                m_sparseIndices = std::move(sortedIndices);
+                m_sparseValues = std::move(sortedValues);
+            }
+
+            AccessorView<T> m_baseView;
+            bool            m_hasBaseView;
+
+            size_t m_elementCount;
+            size_t m_typeCount;
+
+            std::vector<uint32_t> m_sparseIndices;
+            std::vector<T>        m_sparseValues;
+        };
+    }
+}
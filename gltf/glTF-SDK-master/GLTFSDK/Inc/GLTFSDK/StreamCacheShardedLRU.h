@@ -0,0 +1,142 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/StreamCacheLRU.h>
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // A thread-safe stream cache that partitions uris, by hash, across a fixed number of shards. Each shard is
+        // an independent StreamCacheLRU guarded by its own mutex so concurrent calls for different uris rarely
+        // contend. Eviction is per shard and so only approximately 'Least Recently Used'. The cacheMaxSize streams are
+        // divided between the shards (each of which holds cacheMaxSize / shardCount streams, or one more) so the total
+        // never exceeds cacheMaxSize, but a shard may evict while others have space. Unless specified, the shard count is
+        // chosen so that each shard holds at least MinDefaultShardSize streams: with fewer, e.g. 16 shards for a
+        // cacheMaxSize of 16, any two uris in the same shard evict each other and the cache is barely an LRU at all.
+        //
+        // Note: the generating functor may be called concurrently (for uris in different shards) and so must itself
+        // be thread-safe. The streams returned by the cache are shared and are not synchronized by the cache.
+        template<typename TStream>
+        class StreamCacheShardedLRU : public IStreamCache<TStream>
+        {
+        public:
+            static constexpr size_t MaxDefaultShardCount = 16U;
+            static constexpr size_t MinDefaultShardSize = 4U;
+
+            template<typename Fn>
+            StreamCacheShardedLRU(Fn fnGenerate, size_t cacheMaxSize = std::numeric_limits<size_t>::max()) :
+                StreamCacheShardedLRU(fnGenerate, cacheMaxSize, GetDefaultShardCount(cacheMaxSize))
+            {
+            }
+
+            template<typename Fn>
+            StreamCacheShardedLRU(Fn fnGenerate, size_t cacheMaxSize, size_t shardCount) :
+                cacheMaxSize(cacheMaxSize)
+            {
+                if (cacheMaxSize == 0U)
+                {
+                    throw GLTFException("LRU max cache size must be greater than zero");
+                }
+
+                if (shardCount == 0U)
+                {
+                    throw GLTFException("Sharded LRU shard count must be greater than zero");
+                }
+
+                // Each shard must be able to hold at least one stream without exceeding cacheMaxSize in total
+                shardCount = std::min(shardCount, cacheMaxSize);
+
+                // The remainder is spread across the first shards, one stream each
+                const size_t shardMaxSize = cacheMaxSize / shardCount;
+                const size_t remainder = cacheMaxSize % shardCount;
+
+                m_shards.reserve(shardCount);
+
+                for (size_t i = 0U; i < shardCount; ++i)
+                {
+                    m_shards.push_back(std::make_unique<Shard>(fnGenerate, i < remainder ? shardMaxSize + 1U : shardMaxSize));
+                }
+            }
+
+            TStream Get(const std::string& uri) override
+            {
+                auto& shard = GetShard(uri);
+
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                return shard.cache.Get(uri);
+            }
+
+            TStream Set(const std::string& uri, TStream stream) override
+            {
+                auto& shard = GetShard(uri);
+
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                return shard.cache.Set(uri, std::move(stream));
+            }
+
+            size_t Size() const
+            {
+                size_t size = 0U;
+
+                for (const auto& shard : m_shards)
+                {
+                    std::lock_guard<std::mutex> lock(shard->mutex);
+                    size += shard->cache.Size();
+                }
+
+                return size;
+            }
+
+            size_t GetShardCount() const
+            {
+                return m_shards.size();
+            }
+
+            // Returns MaxDefaultShardCount shards, or fewer so that each holds at least MinDefaultShardSize streams
+            static size_t GetDefaultShardCount(size_t cacheMaxSize)
+            {
+                return std::max<size_t>(1U, std::min(MaxDefaultShardCount, cacheMaxSize / MinDefaultShardSize));
+            }
+
+            const size_t cacheMaxSize;
+
+        private:
+            struct Shard
+            {
+                template<typename Fn>
+                Shard(Fn fnGenerate, size_t shardMaxSize) : cache(fnGenerate, shardMaxSize)
+                {
+                }
+
+                mutable std::mutex mutex;
+                StreamCacheLRU<TStream> cache;
+            };
+
+            Shard& GetShard(const std::string& uri)
+            {
+                return *m_shards[std::hash<std::string>()(uri) % m_shards.size()];
+            }
+
+            std::vector<std::unique_ptr<Shard>> m_shards;
+        };
+
+        template<typename TStream>
+        constexpr size_t StreamCacheShardedLRU<TStream>::MaxDefaultShardCount;
+
+        template<typename TStream>
+        constexpr size_t StreamCacheShardedLRU<TStream>::MinDefaultShardSize;
+
+        typedef StreamCacheShardedLRU<std::shared_ptr<std::istream>> StreamReaderCacheShardedLRU;
+        typedef StreamCacheShardedLRU<std::shared_ptr<std::ostream>> StreamWriterCacheShardedLRU;
+    }
+}
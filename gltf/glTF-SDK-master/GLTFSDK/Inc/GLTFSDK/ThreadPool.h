@@ -0,0 +1,68 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/Executor.h>
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // A fixed size pool of worker threads that execute submitted tasks in FIFO order. The destructor
+        // waits for all queued tasks to complete before joining the worker threads. A task may submit tasks to
+        // the pool it is running on and wait for them via a FutureWaiter constructed with the pool: while it
+        // waits its thread runs queued tasks. Waiting on the futures directly (e.g. future::get) from a task
+        // can deadlock once every thread of the pool is waiting.
+        class ThreadPool : public IExecutor
+        {
+        public:
+            // A threadCount of zero uses std::thread::hardware_concurrency() threads (at least one)
+            explicit ThreadPool(size_t threadCount = 0U);
+            ~ThreadPool();
+
+            ThreadPool(const ThreadPool&) = delete;
+            ThreadPool& operator=(const ThreadPool&) = delete;
+
+            size_t GetThreadCount() const;
+
+            // Queues fn for execution on one of the pool's threads. Any exception thrown by fn is stored
+            // in the returned future and rethrown by future::get
+            template<typename Fn>
+            std::future<typename std::result_of<Fn()>::type> Submit(Fn fn)
+            {
+                return glTF::Submit(static_cast<IExecutor&>(*this), std::move(fn));
+            }
+
+            // Queues the task for execution on one of the pool's threads
+            void Execute(std::function<void()> task) override;
+
+            // Only runs a queued task when called from one of the pool's own threads. Other threads leave the tasks
+            // to the pool so that its thread count bounds how many of its tasks run at once.
+            bool TryExecutePending() override;
+
+        private:
+            void Run();
+            void Stop();
+
+            // Removes the task at the front of the queue, if any. m_mutex must be held.
+            bool PopTask(std::function<void()>& task);
+
+            std::vector<std::thread> m_threads;
+            std::queue<std::function<void()>> m_tasks;
+
+            std::mutex m_mutex;
+            std::condition_variable m_condition;
+            bool m_isStopping;
+        };
+    }
+}
@@ -0,0 +1,192 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/BufferRangeCache.h>
+
+#include <GLTFSDK/Exceptions.h>
+
+#include <atomic>
+#include <functional>
+#include <iterator>
+
+using namespace Microsoft::glTF;
+
+size_t BufferRangeCache::KeyHash::operator()(const Key& key) const
+{
+    size_t hash = std::hash<std::string>()(key.bufferRange.bufferId);
+
+    hash ^= std::hash<uint64_t>()(key.sourceId) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash ^= std::hash<size_t>()(key.bufferRange.byteOffset) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash ^= std::hash<size_t>()(key.bufferRange.byteLength) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+
+    return hash;
+}
+
+BufferRangeCache::BufferRangeCache(size_t byteBudget, float protectedFraction) :
+    m_byteBudget(byteBudget),
+    m_protectedByteBudget(static_cast<size_t>(static_cast<double>(byteBudget) * protectedFraction)),
+    m_byteSize(0U),
+    m_protectedByteSize(0U),
+    m_hitCount(0U),
+    m_missCount(0U),
+    m_evictionCount(0U)
+{
+    if (protectedFraction < 0.0f || protectedFraction > 1.0f)
+    {
+        throw GLTFException("BufferRangeCache protected fraction must be between 0 and 1");
+    }
+}
+
+uint64_t BufferRangeCache::CreateSourceId()
+{
+    static std::atomic<uint64_t> nextSourceId(0U);
+
+    return nextSourceId++;
+}
+
+std::shared_ptr<const std::vector<uint8_t>> BufferRangeCache::Get(uint64_t sourceId, const BufferRange& bufferRange)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_entries.find({ sourceId, bufferRange });
+
+    if (it == m_entries.end())
+    {
+        ++m_missCount;
+        return nullptr;
+    }
+
+    ++m_hitCount;
+
+    auto entryIt = it->second;
+
+    if (entryIt->isProtected)
+    {
+        m_protected.splice(m_protected.begin(), m_protected, entryIt);
+    }
+    else if (entryIt->data->size() <= m_protectedByteBudget)
+    {
+        // A second request promotes the range to the protected segment
+        entryIt->isProtected = true;
+        m_protectedByteSize += entryIt->data->size();
+        m_protected.splice(m_protected.begin(), m_probationary, entryIt);
+
+        // Demote the protected segment's least recently used ranges while it exceeds its budget
+        while (m_protectedByteSize > m_protectedByteBudget)
+        {
+            auto demotedIt = std::prev(m_protected.end());
+
+            demotedIt->isProtected = false;
+            m_protectedByteSize -= demotedIt->data->size();
+            m_probationary.splice(m_probationary.begin(), m_protected, demotedIt);
+        }
+    }
+    else
+    {
+        m_probationary.splice(m_probationary.begin(), m_probationary, entryIt);
+    }
+
+    return entryIt->data;
+}
+
+bool BufferRangeCache::Insert(uint64_t sourceId, const BufferRange& bufferRange, std::shared_ptr<const std::vector<uint8_t>> data)
+{
+    if (!data)
+    {
+        throw GLTFException("BufferRangeCache data must not be null");
+    }
+
+    const Key key = { sourceId, bufferRange };
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_entries.find(key);
+
+    if (it != m_entries.end())
+    {
+        Erase(it->second);
+    }
+
+    if (data->size() > m_byteBudget)
+    {
+        return false;
+    }
+
+    m_byteSize += data->size();
+    m_probationary.push_front({ key, std::move(data), false });
+    m_entries[key] = m_probationary.begin();
+
+    while (m_byteSize > m_byteBudget)
+    {
+        Evict();
+    }
+
+    return true;
+}
+
+void BufferRangeCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_entries.clear();
+    m_probationary.clear();
+    m_protected.clear();
+
+    m_byteSize = 0U;
+    m_protectedByteSize = 0U;
+}
+
+size_t BufferRangeCache::GetByteBudget() const
+{
+    return m_byteBudget;
+}
+
+size_t BufferRangeCache::GetByteSize() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_byteSize;
+}
+
+size_t BufferRangeCache::GetHitCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_hitCount;
+}
+
+size_t BufferRangeCache::GetMissCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_missCount;
+}
+
+size_t BufferRangeCache::GetEvictionCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_evictionCount;
+}
+
+void BufferRangeCache::Erase(EntryList::iterator it)
+{
+    m_byteSize -= it->data->size();
+    m_entries.erase(it->key);
+
+    if (it->isProtected)
+    {
+        m_protectedByteSize -= it->data->size();
+        m_protected.erase(it);
+    }
+    else
+    {
+        m_probationary.erase(it);
+    }
+}
+
+void BufferRangeCache::Evict()
+{
+    // Evict from the probationary segment first, only falling back to the protected segment when the
+    // probationary segment contains nothing but the range that was just inserted (at its front)
+    auto& entries = m_probationary.size() > 1U ? m_probationary : m_protected;
+
+    Erase(std::prev(entries.end()));
+    ++m_evictionCount;
+}
@@ -0,0 +1,164 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/Deinterleave.h>
+
+#include <GLTFSDK/Exceptions.h>
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GLTFSDK_DEINTERLEAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    // A fixed element size lets the compiler replace each memcpy with one or two register sized moves
+    template<size_t ElementSize>
+    void DeinterleaveFixed(const uint8_t* src, size_t srcByteStride, size_t elementCount, uint8_t* dst)
+    {
+        for (size_t i = 0U; i < elementCount; ++i, src += srcByteStride, dst += ElementSize)
+        {
+            std::memcpy(dst, src, ElementSize);
+        }
+    }
+
+#ifdef GLTFSDK_DEINTERLEAVE_SSE2
+    template<>
+    void DeinterleaveFixed<12U>(const uint8_t* src, size_t srcByteStride, size_t elementCount, uint8_t* dst)
+    {
+        // Copy 16 bytes per element so each element requires a single load and store. The 4 extra bytes
+        // written are overwritten by the following element. The extra bytes read are always within the
+        // source range as the next element begins at least 12 bytes later. The final element is copied
+        // exactly so that neither the source nor destination range is exceeded.
+        for (size_t i = 1U; i < elementCount; ++i, src += srcByteStride, dst += 12U)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+        }
+
+        std::memcpy(dst, src, 12U);
+    }
+
+    template<>
+    void DeinterleaveFixed<16U>(const uint8_t* src, size_t srcByteStride, size_t elementCount, uint8_t* dst)
+    {
+        for (size_t i = 0U; i < elementCount; ++i, src += srcByteStride, dst += 16U)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+        }
+    }
+
+    template<>
+    void DeinterleaveFixed<32U>(const uint8_t* src, size_t srcByteStride, size_t elementCount, uint8_t* dst)
+    {
+        for (size_t i = 0U; i < elementCount; ++i, src += srcByteStride, dst += 32U)
+        {
+            const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+            const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 16U));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), lo);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 16U), hi);
+        }
+    }
+#endif
+
+    template<size_t ElementSize>
+    void ScatterFixed(const uint8_t* src, const uint32_t* indices, size_t elementCount, uint8_t* dst)
+    {
+        for (size_t i = 0U; i < elementCount; ++i, src += ElementSize)
+        {
+            std::memcpy(dst + static_cast<size_t>(indices[i]) * ElementSize, src, ElementSize);
+        }
+    }
+}
+
+void Microsoft::glTF::Deinterleave(const void* src, size_t srcByteStride, size_t elementCount, size_t elementSize, void* dst)
+{
+    if (elementCount == 0U || elementSize == 0U)
+    {
+        return;
+    }
+
+    if (srcByteStride < elementSize)
+    {
+        throw GLTFException("Deinterleave source byte stride is less than the element size");
+    }
+
+    auto srcBytes = static_cast<const uint8_t*>(src);
+    auto dstBytes = static_cast<uint8_t*>(dst);
+
+    if (srcByteStride == elementSize)
+    {
+        std::memcpy(dstBytes, srcBytes, elementCount * elementSize);
+        return;
+    }
+
+    switch (elementSize)
+    {
+    case 1U:
+        DeinterleaveFixed<1U>(srcBytes, srcByteStride, elementCount, dstBytes);
+        break;
+    case 2U:
+        DeinterleaveFixed<2U>(srcBytes, srcByteStride, elementCount, dstBytes);
+        break;
+    case 4U:
+        DeinterleaveFixed<4U>(srcBytes, srcByteStride, elementCount, dstBytes);
+        break;
+    case 8U:
+        DeinterleaveFixed<8U>(srcBytes, srcByteStride, elementCount, dstBytes);
+        break;
+    case 12U:
+        DeinterleaveFixed<12U>(srcBytes, srcByteStride, elementCount, dstBytes);
+        break;
+    case 16U:
+        DeinterleaveFixed<16U>(srcBytes, srcByteStride, elementCount, dstBytes);
+        break;
+    case 32U:
+        DeinterleaveFixed<32U>(srcBytes, srcByteStride, elementCount, dstBytes);
+        break;
+    default:
+        for (size_t i = 0U; i < elementCount; ++i, srcBytes += srcByteStride, dstBytes += elementSize)
+        {
+            std::memcpy(dstBytes, srcBytes, elementSize);
+        }
+        break;
+    }
+}
+
+void Microsoft::glTF::Scatter(const void* src, const uint32_t* indices, size_t elementCount, size_t elementSize, void* dst)
+{
+    auto srcBytes = static_cast<const uint8_t*>(src);
+    auto dstBytes = static_cast<uint8_t*>(dst);
+
+    switch (elementSize)
+    {
+    case 1U:
+        ScatterFixed<1U>(srcBytes, indices, elementCount, dstBytes);
+        break;
+    case 2U:
+        ScatterFixed<2U>(srcBytes, indices, elementCount, dstBytes);
+        break;
+    case 4U:
+        ScatterFixed<4U>(srcBytes, indices, elementCount, dstBytes);
+        break;
+    case 8U:
+        ScatterFixed<8U>(srcBytes, indices, elementCount, dstBytes);
+        break;
+    case 12U:
+        ScatterFixed<12U>(srcBytes, indices, elementCount, dstBytes);
+        break;
+    case 16U:
+        ScatterFixed<16U>(srcBytes, indices, elementCount, dstBytes);
+        break;
+    default:
+        for (size_t i = 0U; i < elementCount; ++i, srcBytes += elementSize)
+        {
+            std::memcpy(dstBytes + static_cast<size_t>(indices[i]) * elementSize, srcBytes, elementSize);
+        }
+        break;
+    }
+}
@@ -4,19 +4,37 @@
 #include <GLTFSDK/Deserialize.h>
 
 #include <GLTFSDK/Constants.h>
+#include <GLTFSDK/Executor.h>
 #include <GLTFSDK/ExtensionHandlers.h>
 #include <GLTFSDK/GLTF.h>
+#include <GLTFSDK/JsonArena.h>
 #include <GLTFSDK/RapidJsonUtils.h>
 #include <GLTFSDK/Serialize.h>
 #include <GLTFSDK/SchemaValidation.h>
 
+#include <algorithm>
+#include <cstring>
+#include <future>
 #include <iostream>
+#include <vector>
 
 using namespace Microsoft::glTF;
 
 namespace
 {
-    void ParseExtensions(const rapidjson::Value& v, glTFProperty& node, const ExtensionDeserializer& extensionDeserializer)
+    // The state shared by the Parse functions during a single call to Deserialize
+    struct DeserializeContext
+    {
+        const ExtensionDeserializer& extensionDeserializer;
+        DeserializeFlags flags;
+    };
+
+    bool HasFlag(DeserializeFlags flags, DeserializeFlags flag)
+    {
+        return ((flags & flag) == flag);
+    }
+
+    void ParseExtensions(const rapidjson::Value& v, glTFProperty& node, const DeserializeContext& context)
     {
         const auto& extensionsIt = v.FindMember("extensions");
         if (extensionsIt != v.MemberEnd())
@@ -24,51 +42,82 @@ namespace
             const rapidjson::Value& extensionsObject = extensionsIt->value;
             for (const auto& entry : extensionsObject.GetObject())
             {
-                ExtensionPair extensionPair = { entry.name.GetString(), Serialize(entry.value) };
+                const std::string name = entry.name.GetString();
 
-                if (extensionDeserializer.HasHandler(extensionPair.name, node) ||
-                    extensionDeserializer.HasHandler(extensionPair.name))
+                if (context.extensionDeserializer.HasHandler(name, node) ||
+                    context.extensionDeserializer.HasHandler(name))
                 {
-                    node.SetExtension(extensionDeserializer.Deserialize(extensionPair, node));
+                    // The handler is passed the parsed value - it is only serialized if the handler requires a string
+                    node.SetExtension(context.extensionDeserializer.Deserialize(name, JsonValue{ entry.value }, node));
                 }
                 else
                 {
-                    node.extensions.emplace(std::move(extensionPair.name), std::move(extensionPair.value));
+                    context.extensionDeserializer.DeserializeUnhandledExtension(name, JsonValue{ entry.value }, node);
                 }
             }
         }
     }
 
-    void ParseExtras(const rapidjson::Value& v, glTFProperty& node)
+    void ParseExtras(const rapidjson::Value& v, glTFProperty& node, const DeserializeContext& context)
     {
         rapidjson::Value::ConstMemberIterator it;
         if (TryFindMember("extras", v, it))
         {
-            const rapidjson::Value& a = it->value;
-            node.extras = Serialize(a);
+            context.extensionDeserializer.DeserializeExtras(JsonValue{ it->value }, node);
         }
     }
 
-    void ParseProperty(const rapidjson::Value& v, glTFProperty& node, const ExtensionDeserializer& extensionDeserializer)
+    void ParseProperty(const rapidjson::Value& v, glTFProperty& node, const DeserializeContext& context)
     {
-        ParseExtensions(v, node, extensionDeserializer);
-        ParseExtras(v, node);
+        if (!HasFlag(context.flags, DeserializeFlags::SkipExtensions))
+        {
+            ParseExtensions(v, node, context);
+        }
+
+        if (!HasFlag(context.flags, DeserializeFlags::SkipExtras))
+        {
+            ParseExtras(v, node, context);
+        }
     }
 
-    void ParseTextureInfo(const rapidjson::Value& v, TextureInfo& textureInfo, const ExtensionDeserializer& extensionDeserializer)
+    void ParseTextureInfo(const rapidjson::Value& v, TextureInfo& textureInfo, const DeserializeContext& context)
     {
         auto textureIndexIt = FindRequiredMember("index", v);
         textureInfo.textureId = std::to_string(textureIndexIt->value.GetUint());
         textureInfo.texCoord = GetMemberValueOrDefault<size_t>(v, "texCoord", 0U);
-        ParseProperty(v, textureInfo, extensionDeserializer);
+        ParseProperty(v, textureInfo, context);
+    }
+
+    template<typename T>
+    void AppendToIndexedContainer(
+        IndexedContainer<const T>& items,
+        const char* name,
+        size_t index,
+        const rapidjson::Value& value,
+        const DeserializeContext& context,
+        T(*fn)(const rapidjson::Value&, const DeserializeContext&))
+    {
+        try
+        {
+            const auto& item = items.Append(fn(value, context), AppendIdPolicy::GenerateOnEmpty);
+            const auto& itemId = item.id;
+
+            (void)itemId;   // To disable unused-variable warnings when assert is compiled away.
+            assert(itemId == std::to_string(index));
+        }
+        catch (const InvalidGLTFException& e)
+        {
+            std::cerr << "Could not parse " << name << "[" << index << "]: " << e.what() << "\n";
+            throw;
+        }
     }
 
     template<typename T>
     IndexedContainer<const T> DeserializeToIndexedContainer(
         const char* name,
         const rapidjson::Value& value,
-        const ExtensionDeserializer& extensionDeserializer,
-        T(*fn)(const rapidjson::Value&, const ExtensionDeserializer&))
+        const DeserializeContext& context,
+        T(*fn)(const rapidjson::Value&, const DeserializeContext&))
     {
         IndexedContainer<const T> items;
 
@@ -79,28 +128,14 @@ namespace
 
             for (auto& valueArray : it->value.GetArray())
             {
-                try
-                {
-                    const auto& item = items.Append(fn(valueArray, extensionDeserializer), AppendIdPolicy::GenerateOnEmpty);
-                    const auto& itemId = item.id;
-
-                    (void)itemId;   // To disable unused-variable warnings when assert is compiled away.
-                    assert(itemId == std::to_string(index));
-                }
-                catch (const InvalidGLTFException& e)
-                {
-                    std::cerr << "Could not parse " << name << "[" << index << "]: " << e.what() << "\n";
-                    throw;
-                }
-
-                ++index;
+                AppendToIndexedContainer(items, name, index++, valueArray, context, fn);
             }
         }
 
         return items;
     }
 
-    Asset ParseAsset(const rapidjson::Value& assetValue, const ExtensionDeserializer& extensionDeserializer)
+    Asset ParseAsset(const rapidjson::Value& assetValue, const DeserializeContext& context)
     {
         Asset asset;
 
@@ -109,12 +144,12 @@ namespace
         asset.version = FindRequiredMember("version", assetValue)->value.GetString();
         asset.minVersion = GetMemberValueOrDefault<std::string>(assetValue, "minVersion");
 
-        ParseProperty(assetValue, asset, extensionDeserializer);
+        ParseProperty(assetValue, asset, context);
 
         return asset;
     }
 
-    Accessor ParseAccessor(const rapidjson::Value& v, const ExtensionDeserializer& extensionDeserializer)
+    Accessor ParseAccessor(const rapidjson::Value& v, const DeserializeContext& context)
     {
         Accessor accessor;
         accessor.name = GetMemberValueOrDefault<std::string>(v, "name");
@@ -168,12 +203,12 @@ namespace
             }
         }
 
-        ParseProperty(v, accessor, extensionDeserializer);
+        ParseProperty(v, accessor, context);
 
         return accessor;
     }
 
-    BufferView ParseBufferView(const rapidjson::Value& v, const ExtensionDeserializer& extensionDeserializer)
+    BufferView ParseBufferView(const rapidjson::Value& v, const DeserializeContext& context)
     {
         BufferView bv;
 
@@ -195,12 +230,12 @@ namespace
             bv.target = static_cast<BufferViewTarget>(itTarget->value.GetUint());
         }
 
-        ParseProperty(v, bv, extensionDeserializer);
+        ParseProperty(v, bv, context);
 
         return bv;
     }
 
-    Scene ParseScene(const rapidjson::Value& v, const ExtensionDeserializer& extensionDeserializer)
+    Scene ParseScene(const rapidjson::Value& v, const DeserializeContext& context)
     {
         Scene scene;
         scene.name = GetMemberValueOrDefault<std::string>(v, "name");
@@ -216,7 +251,7 @@ namespace
             }
         }
 
-        ParseProperty(v, scene, extensionDeserializer);
+        ParseProperty(v, scene, context);
 
         return scene;
     }
@@ -245,7 +280,7 @@ namespace
         }
     }
 
-    MeshPrimitive ParseMeshPrimitive(const rapidjson::Value& v, const ExtensionDeserializer& extensionDeserializer)
+    MeshPrimitive ParseMeshPrimitive(const rapidjson::Value& v, const DeserializeContext& context)
     {
         MeshPrimitive primitive;
 
@@ -266,12 +301,12 @@ namespace
         primitive.mode = static_cast<MeshMode>(GetMemberValueOrDefault<int>(v, "mode", MESH_TRIANGLES));
         ParseTargets(v, primitive);
 
-        ParseProperty(v, primitive, extensionDeserializer);
+        ParseProperty(v, primitive, context);
 
         return primitive;
     }
 
-    Mesh ParseMesh(const rapidjson::Value& v, const ExtensionDeserializer& extensionDeserializer)
+    Mesh ParseMesh(const rapidjson::Value& v, const DeserializeContext& context)
     {
         Mesh mesh;
         mesh.name = GetMemberValueOrDefault<std::string>(v, "name");
@@ -284,13 +319,13 @@ namespace
             mesh.primitives.reserve(a.Capacity());
             for (rapidjson::Value::ConstValueIterator ait = a.Begin(); ait != a.End(); ++ait)
             {
-                mesh.primitives.push_back(ParseMeshPrimitive(*ait, extensionDeserializer));
+                mesh.primitives.push_back(ParseMeshPrimitive(*ait, context));
             }
         }
 
         mesh.weights = RapidJsonUtils::ToFloatArray(v, "weights");
 
-        ParseProperty(v, mesh, extensionDeserializer);
+        ParseProperty(v, mesh, context);
 
         return mesh;
     }
@@ -401,7 +436,7 @@ namespace
         }
     }
 
-    Camera ParseCamera(const rapidjson::Value& v, const ExtensionDeserializer& extensionDeserializer)
+    Camera ParseCamera(const rapidjson::Value& v, const DeserializeContext& context)
     {
         std::unique_ptr<Projection> projection;
         std::string projectionType = FindRequiredMember("type", v)->value.GetString();
@@ -438,7 +473,7 @@ namespace
             perspective->zfar = zfar;
             perspective->aspectRatio = aspectRatio;
 
-            ParseProperty(perspectiveIt->value, *perspective, extensionDeserializer);
+            ParseProperty(perspectiveIt->value, *perspective, context);
 
             projection = std::move(perspective);
         }
@@ -456,7 +491,7 @@ namespace
             float znear = GetValue<float>(FindRequiredMember("znear", orthographicIt->value)->value);
             projection = std::make_unique<Orthographic>(zfar, znear, xmag, ymag);
 
-            ParseProperty(orthographicIt->value, *projection, extensionDeserializer);
+            ParseProperty(orthographicIt->value, *projection, context);
         }
 
         // Camera constructor will throw a GLTFException when projection is null (i.e. source manifest specified an invalid projection type)
@@ -468,12 +503,12 @@ namespace
             throw InvalidGLTFException("Camera's projection is not valid");
         }
 
-        ParseProperty(v, camera, extensionDeserializer);
+        ParseProperty(v, camera, context);
 
         return camera;
     }
 
-    Node ParseNode(const rapidjson::Value& v, const ExtensionDeserializer& extensionDeserializer)
+    Node ParseNode(const rapidjson::Value& v, const DeserializeContext& context)
     {
         Node node;
         node.name = GetMemberValueOrDefault<std::string>(v, "name");
@@ -485,24 +520,24 @@ namespace
         ParseNodeMatrix(v, node);
         node.weights = RapidJsonUtils::ToFloatArray(v, "weights");
 
-        ParseProperty(v, node, extensionDeserializer);
+        ParseProperty(v, node, context);
 
         return node;
     }
 
-    Buffer ParseBuffer(const rapidjson::Value& v, const ExtensionDeserializer& extensionDeserializer)
+    Buffer ParseBuffer(const rapidjson::Value& v, const DeserializeContext& context)
     {
         Buffer buffer;
 
         buffer.byteLength = GetValue<size_t>(FindRequiredMember("byteLength", v)->value);
         buffer.uri = GetMemberValueOrDefault<std::string>(v, "uri");
 
-        ParseProperty(v, buffer, extensionDeserializer);
+        ParseProperty(v, buffer, context);
 
         return buffer;
     }
 
-    Sampler ParseSampler(const rapidjson::Value& v, const ExtensionDeserializer& extensionDeserializer)
+    Sampler ParseSampler(const rapidjson::Value& v, const DeserializeContext& context)
     {
         Sampler sampler;
 
@@ -522,12 +557,12 @@ namespace
             sampler.magFilter = Sampler::GetSamplerMagFilterMode(itMag->value.GetUint());
         }
 
-        ParseProperty(v, sampler, extensionDeserializer);
+        ParseProperty(v, sampler, context);
 
         return sampler;
     }
 
-    AnimationTarget ParseAnimationTarget(const rapidjson::Value& v, const ExtensionDeserializer& extensionDeserializer)
+    AnimationTarget ParseAnimationTarget(const rapidjson::Value& v, const DeserializeContext& context)
     {
         try
         {
@@ -541,7 +576,7 @@ namespace
                 target.path = ParseTargetPath(it->value.GetString());
             }
 
-            ParseProperty(v, target, extensionDeserializer);
+            ParseProperty(v, target, context);
 
             return target;
         }
@@ -552,16 +587,16 @@ namespace
         }
     }
 
-    AnimationChannel ParseAnimationChannel(const rapidjson::Value& v, const ExtensionDeserializer& extensionDeserializer)
+    AnimationChannel ParseAnimationChannel(const rapidjson::Value& v, const DeserializeContext& context)
     {
         try
         {
             AnimationChannel channel;
 
             channel.samplerId = GetMemberValueAsString<uint32_t>(v, "sampler");
-            channel.target = ParseAnimationTarget(FindRequiredMember("target", v)->value, extensionDeserializer);
+            channel.target = ParseAnimationTarget(FindRequiredMember("target", v)->value, context);
 
-            ParseProperty(v, channel, extensionDeserializer);
+            ParseProperty(v, channel, context);
 
             return channel;
         }
@@ -572,7 +607,7 @@ namespace
         }
     }
 
-    AnimationSampler ParseAnimationSampler(const rapidjson::Value& v, const ExtensionDeserializer& extensionDeserializer)
+    AnimationSampler ParseAnimationSampler(const rapidjson::Value& v, const DeserializeContext& context)
     {
         AnimationSampler sampler;
 
@@ -585,26 +620,26 @@ namespace
             sampler.interpolation = ParseInterpolationType(it->value.GetString());
         }
 
-        ParseProperty(v, sampler, extensionDeserializer);
+        ParseProperty(v, sampler, context);
 
         return sampler;
     }
 
-    Animation ParseAnimation(const rapidjson::Value& v, const ExtensionDeserializer& extensionDeserializer)
+    Animation ParseAnimation(const rapidjson::Value& v, const DeserializeContext& context)
     {
         Animation anim;
         anim.name = GetMemberValueOrDefault<std::string>(v, "name");
 
-        anim.channels = DeserializeToIndexedContainer<AnimationChannel>("channels", v, extensionDeserializer, ParseAnimationChannel);
+        anim.channels = DeserializeToIndexedContainer<AnimationChannel>("channels", v, context, ParseAnimationChannel);
 
-        anim.samplers = DeserializeToIndexedContainer<AnimationSampler>("samplers", v, extensionDeserializer, ParseAnimationSampler);
+        anim.samplers = DeserializeToIndexedContainer<AnimationSampler>("samplers", v, context, ParseAnimationSampler);
 
-        ParseProperty(v, anim, extensionDeserializer);
+        ParseProperty(v, anim, context);
 
         return anim;
     }
 
-    Skin ParseSkin(const rapidjson::Value& v, const ExtensionDeserializer& extensionDeserializer)
+    Skin ParseSkin(const rapidjson::Value& v, const DeserializeContext& context)
     {
         Skin skin;
 
@@ -623,12 +658,12 @@ namespace
             }
         }
 
-        ParseProperty(v, skin, extensionDeserializer);
+        ParseProperty(v, skin, context);
 
         return skin;
     }
 
-    void ParseExtensionsUsed(const rapidjson::Document& d, Document& gltfDocument)
+    void ParseExtensionsUsed(const rapidjson::Value& d, Document& gltfDocument)
     {
         rapidjson::Value::ConstMemberIterator it;
         if (TryFindMember("extensionsUsed", d, it))
@@ -641,7 +676,7 @@ namespace
         }
     }
 
-    void ParseExtensionsRequired(const rapidjson::Document& d, Document& gltfDocument)
+    void ParseExtensionsRequired(const rapidjson::Value& d, Document& gltfDocument)
     {
         rapidjson::Value::ConstMemberIterator it;
         if (TryFindMember("extensionsRequired", d, it))
@@ -662,7 +697,7 @@ namespace
         }
     }
 
-    Material ParseMaterial(const rapidjson::Value& v, const ExtensionDeserializer& extensionDeserializer)
+    Material ParseMaterial(const rapidjson::Value& v, const DeserializeContext& context)
     {
         Material material;
 
@@ -686,7 +721,7 @@ namespace
             auto baseColorTextureIt = pbrMr.FindMember("baseColorTexture");
             if (baseColorTextureIt != pbrMr.MemberEnd())
             {
-                ParseTextureInfo(baseColorTextureIt->value, material.metallicRoughness.baseColorTexture, extensionDeserializer);
+                ParseTextureInfo(baseColorTextureIt->value, material.metallicRoughness.baseColorTexture, context);
             }
 
             material.metallicRoughness.metallicFactor = GetMemberValueOrDefault<float>(pbrMr, "metallicFactor", 1.0f);
@@ -695,7 +730,7 @@ namespace
             auto metallicRoughnessTextureIt = pbrMr.FindMember("metallicRoughnessTexture");
             if (metallicRoughnessTextureIt != pbrMr.MemberEnd())
             {
-                ParseTextureInfo(metallicRoughnessTextureIt->value, material.metallicRoughness.metallicRoughnessTexture, extensionDeserializer);
+                ParseTextureInfo(metallicRoughnessTextureIt->value, material.metallicRoughness.metallicRoughnessTexture, context);
             }
         }
 
@@ -703,7 +738,7 @@ namespace
         auto normalTextureIt = v.FindMember("normalTexture");
         if (normalTextureIt != v.MemberEnd())
         {
-            ParseTextureInfo(normalTextureIt->value, material.normalTexture, extensionDeserializer);
+            ParseTextureInfo(normalTextureIt->value, material.normalTexture, context);
             material.normalTexture.scale = GetMemberValueOrDefault<float>(normalTextureIt->value, "scale", 1.0f);
         }
 
@@ -711,7 +746,7 @@ namespace
         auto occlusionTextureIt = v.FindMember("occlusionTexture");
         if (occlusionTextureIt != v.MemberEnd())
         {
-            ParseTextureInfo(occlusionTextureIt->value, material.occlusionTexture, extensionDeserializer);
+            ParseTextureInfo(occlusionTextureIt->value, material.occlusionTexture, context);
             material.occlusionTexture.strength = GetMemberValueOrDefault<float>(occlusionTextureIt->value, "strength", 1.0f);
         }
 
@@ -719,7 +754,7 @@ namespace
         auto emissionTextureIt = v.FindMember("emissiveTexture");
         if (emissionTextureIt != v.MemberEnd())
         {
-            ParseTextureInfo(emissionTextureIt->value, material.emissiveTexture, extensionDeserializer);
+            ParseTextureInfo(emissionTextureIt->value, material.emissiveTexture, context);
         }
 
         // Emissive Factor
@@ -750,14 +785,14 @@ namespace
         // Double Sided
         material.doubleSided = GetMemberValueOrDefault<bool>(v, "doubleSided", false);
 
-        ParseProperty(v, material, extensionDeserializer);
+        ParseProperty(v, material, context);
 
         ValidateMaterial(material);
 
         return material;
     }
 
-    Texture ParseTexture(const rapidjson::Value& v, const ExtensionDeserializer& extensionDeserializer)
+    Texture ParseTexture(const rapidjson::Value& v, const DeserializeContext& context)
     {
         // Parse texture fields or assign default values see:
         // https://github.com/KhronosGroup/glTF/blob/master/specification/README.md
@@ -768,12 +803,12 @@ namespace
         texture.imageId = GetMemberValueAsString<uint32_t>(v, "source");
         texture.samplerId = GetMemberValueAsString<uint32_t>(v, "sampler");
 
-        ParseProperty(v, texture, extensionDeserializer);
+        ParseProperty(v, texture, context);
 
         return texture;
     }
 
-    Image ParseImage(const rapidjson::Value& v, const ExtensionDeserializer& extensionDeserializer)
+    Image ParseImage(const rapidjson::Value& v, const DeserializeContext& context)
     {
         // Parse image fields or assign default values see:
         // https://github.com/KhronosGroup/glTF/blob/master/specification/README.md
@@ -785,53 +820,595 @@ namespace
         image.bufferViewId = GetMemberValueAsString<uint32_t>(v, "bufferView");
         image.mimeType = GetMemberValueOrDefault<std::string>(v, "mimeType");
 
-        ParseProperty(v, image, extensionDeserializer);
+        ParseProperty(v, image, context);
 
         return image;
     }
 
-    Document DeserializeInternal(const rapidjson::Document& document, const ExtensionDeserializer& extensionDeserializer, SchemaFlags schemaFlags)
+    template<typename T, IndexedContainer<const T> Document::*Items, T(*Parse)(const rapidjson::Value&, const DeserializeContext&)>
+    void AppendTopLevelArrayElement(Document& gltfDocument, const char* name, size_t index, const rapidjson::Value& v, const DeserializeContext& context)
     {
-        ValidateDocumentAgainstSchema(document, SCHEMA_URI_GLTF, GetDefaultSchemaLocator(schemaFlags));
+        AppendToIndexedContainer(gltfDocument.*Items, name, index, v, context, Parse);
+    }
 
-        Document gltfDocument;
+    // Parses the elements of a top level array in chunks, each chunk a separate task run via the executor. The
+    // returned function appends the parsed elements to the document, in order, once every chunk has completed.
+    template<typename T, IndexedContainer<const T> Document::*Items, T(*Parse)(const rapidjson::Value&, const DeserializeContext&)>
+    std::function<void(Document&)> ParseTopLevelArrayParallel(
+        const char* name,
+        const rapidjson::Value& values,
+        const DeserializeContext& context,
+        IExecutor& executor,
+        std::vector<std::future<void>>& futures)
+    {
+        static const size_t ChunkSize = 256U;
 
-        rapidjson::Value::ConstMemberIterator it;
-        if (TryFindMember("asset", document, it))
+        const size_t count = values.Size();
+        auto items = std::make_shared<std::vector<Optional<T>>>(count); // Not all glTF objects are default constructible
+
+        // Reserve up front so push_back can't throw and discard the future of a task that has already been submitted
+        futures.reserve(futures.size() + (count + ChunkSize - 1U) / ChunkSize);
+
+        for (size_t begin = 0U; begin < count; begin += ChunkSize)
+        {
+            const size_t end = std::min(begin + ChunkSize, count);
+
+            futures.push_back(Submit(executor, [name, &values, &context, items, begin, end]()
+            {
+                for (size_t index = begin; index < end; ++index)
+                {
+                    try
+                    {
+                        (*items)[index] = Parse(values[static_cast<rapidjson::SizeType>(index)], context);
+                    }
+                    catch (const InvalidGLTFException& e)
+                    {
+                        std::cerr << "Could not parse " << name << "[" << index << "]: " << e.what() << "\n";
+                        throw;
+                    }
+                }
+            }));
+        }
+
+        return [items](Document& gltfDocument)
         {
-            gltfDocument.asset = ParseAsset(it->value, extensionDeserializer);
+            auto& container = gltfDocument.*Items;
+            container.Reserve(items->size());
+
+            for (Optional<T>& item : *items)
+            {
+                container.Append(std::move(item.Get()), AppendIdPolicy::GenerateOnEmpty);
+            }
+        };
+    }
+
+    struct TopLevelArray
+    {
+        const char* name;
+        void(*append)(Document&, const char*, size_t, const rapidjson::Value&, const DeserializeContext&);
+        std::function<void(Document&)>(*parseParallel)(const char*, const rapidjson::Value&, const DeserializeContext&, IExecutor&, std::vector<std::future<void>>&);
+        DeserializeFlags skipFlag;
+    };
+
+    template<typename T, IndexedContainer<const T> Document::*Items, T(*Parse)(const rapidjson::Value&, const DeserializeContext&)>
+    TopLevelArray MakeTopLevelArray(const char* name, DeserializeFlags skipFlag)
+    {
+        return { name, AppendTopLevelArrayElement<T, Items, Parse>, ParseTopLevelArrayParallel<T, Items, Parse>, skipFlag };
+    }
+
+    // The root properties that are arrays of glTF objects, shared by the DOM and streaming deserializers
+    const TopLevelArray TopLevelArrays[] = {
+        MakeTopLevelArray<Accessor,   &Document::accessors,   ParseAccessor>("accessors", DeserializeFlags::None),
+        MakeTopLevelArray<Animation,  &Document::animations,  ParseAnimation>("animations", DeserializeFlags::SkipAnimations),
+        MakeTopLevelArray<Buffer,     &Document::buffers,     ParseBuffer>("buffers", DeserializeFlags::None),
+        MakeTopLevelArray<BufferView, &Document::bufferViews, ParseBufferView>("bufferViews", DeserializeFlags::None),
+        MakeTopLevelArray<Camera,     &Document::cameras,     ParseCamera>("cameras", DeserializeFlags::None),
+        MakeTopLevelArray<Image,      &Document::images,      ParseImage>("images", DeserializeFlags::SkipImages),
+        MakeTopLevelArray<Material,   &Document::materials,   ParseMaterial>("materials", DeserializeFlags::SkipMaterials),
+        MakeTopLevelArray<Mesh,       &Document::meshes,      ParseMesh>("meshes", DeserializeFlags::None),
+        MakeTopLevelArray<Node,       &Document::nodes,       ParseNode>("nodes", DeserializeFlags::None),
+        MakeTopLevelArray<Sampler,    &Document::samplers,    ParseSampler>("samplers", DeserializeFlags::None),
+        MakeTopLevelArray<Scene,      &Document::scenes,      ParseScene>("scenes", DeserializeFlags::None),
+        MakeTopLevelArray<Skin,       &Document::skins,       ParseSkin>("skins", DeserializeFlags::SkipSkins),
+        MakeTopLevelArray<Texture,    &Document::textures,    ParseTexture>("textures", DeserializeFlags::None)
+    };
+
+    bool IsSkipped(const TopLevelArray& topLevelArray, DeserializeFlags flags)
+    {
+        return topLevelArray.skipFlag != DeserializeFlags::None && HasFlag(flags, topLevelArray.skipFlag);
+    }
+
+    const TopLevelArray* FindTopLevelArray(const std::string& name)
+    {
+        for (const auto& topLevelArray : TopLevelArrays)
+        {
+            if (name == topLevelArray.name)
+            {
+                return &topLevelArray;
+            }
         }
 
-        gltfDocument.accessors   = DeserializeToIndexedContainer<Accessor>("accessors", document, extensionDeserializer, ParseAccessor);
-        gltfDocument.animations  = DeserializeToIndexedContainer<Animation>("animations", document, extensionDeserializer, ParseAnimation);
-        gltfDocument.buffers     = DeserializeToIndexedContainer<Buffer>("buffers", document, extensionDeserializer, ParseBuffer);
-        gltfDocument.bufferViews = DeserializeToIndexedContainer<BufferView>("bufferViews", document, extensionDeserializer, ParseBufferView);
-        gltfDocument.cameras     = DeserializeToIndexedContainer<Camera>("cameras", document, extensionDeserializer, ParseCamera);
-        gltfDocument.images      = DeserializeToIndexedContainer<Image>("images", document, extensionDeserializer, ParseImage);
-        gltfDocument.materials   = DeserializeToIndexedContainer<Material>("materials", document, extensionDeserializer, ParseMaterial);
-        gltfDocument.meshes      = DeserializeToIndexedContainer<Mesh>("meshes", document, extensionDeserializer, ParseMesh);
-        gltfDocument.nodes       = DeserializeToIndexedContainer<Node>("nodes", document, extensionDeserializer, ParseNode);
-        gltfDocument.samplers    = DeserializeToIndexedContainer<Sampler>("samplers", document, extensionDeserializer, ParseSampler);
-        gltfDocument.scenes      = DeserializeToIndexedContainer<Scene>("scenes", document, extensionDeserializer, ParseScene);
-        gltfDocument.skins       = DeserializeToIndexedContainer<Skin>("skins", document, extensionDeserializer, ParseSkin);
-        gltfDocument.textures    = DeserializeToIndexedContainer<Texture>("textures", document, extensionDeserializer, ParseTexture);
+        return nullptr;
+    }
+
+    // Parses the root properties that aren't arrays of glTF objects
+    void ParseRootProperties(const rapidjson::Value& root, Document& gltfDocument, const DeserializeContext& context)
+    {
+        rapidjson::Value::ConstMemberIterator it;
+        if (TryFindMember("asset", root, it))
+        {
+            gltfDocument.asset = ParseAsset(it->value, context);
+        }
 
-        ParseProperty(document, gltfDocument, extensionDeserializer);
+        ParseProperty(root, gltfDocument, context);
 
-        if (TryFindMember("scene", document, it))
+        if (TryFindMember("scene", root, it))
         {
             gltfDocument.defaultSceneId = std::to_string(it->value.GetUint());
         }
 
-        ParseExtensionsUsed(document, gltfDocument);
-        ParseExtensionsRequired(document, gltfDocument);
+        ParseExtensionsUsed(root, gltfDocument);
+        ParseExtensionsRequired(root, gltfDocument);
+    }
+
+    Document DeserializeInternal(const rapidjson::Value& document, const DeserializeContext& context, SchemaFlags schemaFlags)
+    {
+        ValidateDocumentAgainstSchema(document, SCHEMA_URI_GLTF, *GetDefaultSchemaCache(schemaFlags));
+
+        Document gltfDocument;
+
+        for (const auto& topLevelArray : TopLevelArrays)
+        {
+            if (IsSkipped(topLevelArray, context.flags))
+            {
+                continue;
+            }
+
+            rapidjson::Value::ConstMemberIterator it;
+            if (TryFindMember(topLevelArray.name, document, it))
+            {
+                size_t index = 0;
+
+                for (const auto& element : it->value.GetArray())
+                {
+                    topLevelArray.append(gltfDocument, topLevelArray.name, index++, element, context);
+                }
+            }
+        }
+
+        ParseRootProperties(document, gltfDocument, context);
 
         return gltfDocument;
     }
 
-    bool HasFlag(DeserializeFlags flags, DeserializeFlags flag)
+    // Parses the elements of every top level array concurrently. The results are identical to DeserializeInternal:
+    // elements are appended to their containers, in order, once all have been parsed and the first exception (in
+    // the order the arrays and elements appear in TopLevelArrays and the manifest) is rethrown.
+    Document DeserializeInternalParallel(const rapidjson::Document& document, const DeserializeContext& context, SchemaFlags schemaFlags, IExecutor& executor)
     {
-        return ((flags & flag) == flag);
+        ValidateDocumentAgainstSchema(document, SCHEMA_URI_GLTF, *GetDefaultSchemaCache(schemaFlags));
+
+        Document gltfDocument;
+
+        // Tasks reference the DOM and the deserialize context so if an exception is thrown while tasks are being
+        // submitted, those already submitted must complete before either is destroyed
+        FutureWaiter<void> waiter(executor);
+        auto& futures = waiter.GetFutures();
+
+        std::vector<std::function<void(Document&)>> appends;
+
+        for (const auto& topLevelArray : TopLevelArrays)
+        {
+            if (IsSkipped(topLevelArray, context.flags))
+            {
+                continue;
+            }
+
+            rapidjson::Value::ConstMemberIterator it;
+            if (TryFindMember(topLevelArray.name, document, it))
+            {
+                appends.push_back(topLevelArray.parseParallel(topLevelArray.name, it->value, context, executor, futures));
+            }
+        }
+
+        // The tasks reference the DOM so all must complete before any exception is rethrown
+        waiter.Wait();
+
+        for (auto& future : futures)
+        {
+            future.get();
+        }
+
+        for (auto& append : appends)
+        {
+            append(gltfDocument);
+        }
+
+        ParseRootProperties(document, gltfDocument, context);
+
+        return gltfDocument;
+    }
+
+    // A SAX handler that builds a rapidjson value from parse events, in the same way rapidjson::Document does,
+    // allocating from the specified allocator
+    class ValueBuilder
+    {
+    public:
+        explicit ValueBuilder(rapidjson::MemoryPoolAllocator<>& allocator) : m_allocator(allocator)
+        {
+        }
+
+        bool Null()                { m_values.emplace_back(); return true; }
+        bool Bool(bool b)          { m_values.emplace_back(b); return true; }
+        bool Int(int i)            { m_values.emplace_back(i); return true; }
+        bool Uint(unsigned u)      { m_values.emplace_back(u); return true; }
+        bool Int64(int64_t i)      { m_values.emplace_back(i); return true; }
+        bool Uint64(uint64_t u)    { m_values.emplace_back(u); return true; }
+        bool Double(double d)      { m_values.emplace_back(d); return true; }
+
+        bool String(const char* str, rapidjson::SizeType length, bool copy)
+        {
+            if (copy)
+            {
+                m_values.emplace_back(str, length, m_allocator);
+            }
+            else
+            {
+                // When parsing in situ the string remains in (and is referenced from) the source buffer
+                m_values.emplace_back(rapidjson::StringRef(str, length));
+            }
+
+            return true;
+        }
+
+        bool RawNumber(const char* str, rapidjson::SizeType length, bool copy)
+        {
+            return String(str, length, copy);
+        }
+
+        bool Key(const char* str, rapidjson::SizeType length, bool copy)
+        {
+            return String(str, length, copy);
+        }
+
+        bool StartObject() { return true; }
+        bool StartArray()  { return true; }
+
+        bool EndObject(rapidjson::SizeType memberCount)
+        {
+            const size_t first = m_values.size() - 2U * memberCount;
+
+            rapidjson::Value object(rapidjson::kObjectType);
+
+            for (size_t i = first; i < m_values.size(); i += 2U)
+            {
+                object.AddMember(m_values[i], m_values[i + 1U], m_allocator);
+            }
+
+            m_values.resize(first);
+            m_values.push_back(std::move(object));
+
+            return true;
+        }
+
+        bool EndArray(rapidjson::SizeType elementCount)
+        {
+            const size_t first = m_values.size() - elementCount;
+
+            rapidjson::Value array(rapidjson::kArrayType);
+            array.Reserve(elementCount, m_allocator);
+
+            for (size_t i = first; i < m_values.size(); ++i)
+            {
+                array.PushBack(m_values[i], m_allocator);
+            }
+
+            m_values.resize(first);
+            m_values.push_back(std::move(array));
+
+            return true;
+        }
+
+        // Removes the completed value from the builder
+        rapidjson::Value Take()
+        {
+            assert(m_values.size() == 1U);
+
+            rapidjson::Value value(std::move(m_values.back()));
+            m_values.pop_back();
+            return value;
+        }
+
+    private:
+        rapidjson::MemoryPoolAllocator<>& m_allocator;
+        std::vector<rapidjson::Value> m_values;
+    };
+
+    // A SAX handler that deserializes a glTF manifest without first building a DOM of the whole document. Each
+    // element of a top level array (accessors, nodes etc.) is built as a small DOM, passed to the same Parse
+    // functions used by DeserializeInternal and then discarded - the allocator used for elements is reset after
+    // each one so peak memory is bounded by the largest element rather than the size of the manifest. All other
+    // root properties are retained and parsed once the entire manifest has been read.
+    class StreamingDeserializer
+    {
+    public:
+        StreamingDeserializer(Document& gltfDocument, const DeserializeContext& context) :
+            m_gltfDocument(gltfDocument),
+            m_context(context),
+            m_elementBuffer(ElementBufferSize),
+            m_elementAllocator(m_elementBuffer.data(), m_elementBuffer.size()),
+            m_elementBuilder(m_elementAllocator),
+            m_depth(0U),
+            m_valueDepth(0U),
+            m_skipping(false),
+            m_topLevelArray(nullptr),
+            m_topLevelArrayIndex(0U)
+        {
+            m_root.SetObject();
+        }
+
+        bool Null()                { return m_depth > 0U && (m_skipping || (m_elementBuilder.Null() && EndValue())); }
+        bool Bool(bool b)          { return m_depth > 0U && (m_skipping || (m_elementBuilder.Bool(b) && EndValue())); }
+        bool Int(int i)            { return m_depth > 0U && (m_skipping || (m_elementBuilder.Int(i) && EndValue())); }
+        bool Uint(unsigned u)      { return m_depth > 0U && (m_skipping || (m_elementBuilder.Uint(u) && EndValue())); }
+        bool Int64(int64_t i)      { return m_depth > 0U && (m_skipping || (m_elementBuilder.Int64(i) && EndValue())); }
+        bool Uint64(uint64_t u)    { return m_depth > 0U && (m_skipping || (m_elementBuilder.Uint64(u) && EndValue())); }
+        bool Double(double d)      { return m_depth > 0U && (m_skipping || (m_elementBuilder.Double(d) && EndValue())); }
+
+        bool String(const char* str, rapidjson::SizeType length, bool copy)
+        {
+            return m_depth > 0U && (m_skipping || (m_elementBuilder.String(str, length, copy) && EndValue()));
+        }
+
+        bool RawNumber(const char* str, rapidjson::SizeType length, bool copy)
+        {
+            return String(str, length, copy);
+        }
+
+        bool Key(const char* str, rapidjson::SizeType length, bool copy)
+        {
+            if (IsRootMember())
+            {
+                m_key.assign(str, length);
+                m_skipping = IsSkippedRootMember(m_key);
+                return true;
+            }
+
+            return m_skipping || m_elementBuilder.Key(str, length, copy);
+        }
+
+        bool StartObject()
+        {
+            if (m_depth == 0U)
+            {
+                m_depth = 1U;
+                return true;
+            }
+
+            ++m_valueDepth;
+            return m_skipping || m_elementBuilder.StartObject();
+        }
+
+        bool EndObject(rapidjson::SizeType memberCount)
+        {
+            if (m_valueDepth == 0U)
+            {
+                // The end of the root object
+                m_depth = 0U;
+                return true;
+            }
+
+            if (m_skipping)
+            {
+                --m_valueDepth;
+                return true;
+            }
+
+            return m_elementBuilder.EndObject(memberCount) && EndComposite();
+        }
+
+        bool StartArray()
+        {
+            // The root of a glTF manifest must be an object
+            if (m_depth == 0U)
+            {
+                return false;
+            }
+
+            if (IsRootMember() && !m_skipping)
+            {
+                if (auto topLevelArray = FindTopLevelArray(m_key))
+                {
+                    // Stream the array's elements rather than building the array
+                    m_topLevelArray = topLevelArray;
+                    m_topLevelArrayIndex = 0U;
+                    m_depth = 2U;
+                    return true;
+                }
+            }
+
+            ++m_valueDepth;
+            return m_skipping || m_elementBuilder.StartArray();
+        }
+
+        bool EndArray(rapidjson::SizeType elementCount)
+        {
+            if (m_valueDepth == 0U)
+            {
+                // The end of a streamed top level array
+                m_topLevelArray = nullptr;
+                m_depth = 1U;
+                return true;
+            }
+
+            if (m_skipping)
+            {
+                --m_valueDepth;
+                return true;
+            }
+
+            return m_elementBuilder.EndArray(elementCount) && EndComposite();
+        }
+
+        void Finish()
+        {
+            ParseRootProperties(m_root, m_gltfDocument, m_context);
+        }
+
+    private:
+        static const size_t ElementBufferSize = 64U * 1024U;
+
+        bool IsRootMember() const
+        {
+            return m_depth == 1U && m_valueDepth == 0U;
+        }
+
+        // Root members excluded by the DeserializeFlags are skipped without building any values
+        bool IsSkippedRootMember(const std::string& key) const
+        {
+            if (auto topLevelArray = FindTopLevelArray(key))
+            {
+                return IsSkipped(*topLevelArray, m_context.flags);
+            }
+
+            return (key == "extensions" && HasFlag(m_context.flags, DeserializeFlags::SkipExtensions)) ||
+                   (key == "extras" && HasFlag(m_context.flags, DeserializeFlags::SkipExtras));
+        }
+
+        bool EndComposite()
+        {
+            --m_valueDepth;
+            return EndValue();
+        }
+
+        // Called after each value - only complete root members and top level array elements are processed
+        bool EndValue()
+        {
+            if (m_valueDepth == 0U)
+            {
+                {
+                    const rapidjson::Value value = m_elementBuilder.Take();
+
+                    if (m_topLevelArray)
+                    {
+                        m_topLevelArray->append(m_gltfDocument, m_topLevelArray->name, m_topLevelArrayIndex++, value, m_context);
+                    }
+                    else if (FindTopLevelArray(m_key))
+                    {
+                        throw InvalidGLTFException("The member " + m_key + " must be an array");
+                    }
+                    else
+                    {
+                        auto& allocator = m_root.GetAllocator();
+
+                        rapidjson::Value name(m_key.c_str(), static_cast<rapidjson::SizeType>(m_key.size()), allocator);
+                        rapidjson::Value copy(value, allocator);
+
+                        m_root.AddMember(name, copy, allocator);
+                    }
+                }
+
+                m_elementAllocator.Clear();
+            }
+
+            return true;
+        }
+
+        Document& m_gltfDocument;
+        const DeserializeContext m_context;
+
+        std::vector<char> m_elementBuffer;
+        rapidjson::MemoryPoolAllocator<> m_elementAllocator;
+        ValueBuilder m_elementBuilder;
+
+        rapidjson::Document m_root;
+
+        size_t m_depth;      // 0 outside the root object, 1 within the root object, 2 within a top level array
+        size_t m_valueDepth; // The nesting depth within the value currently being built
+        std::string m_key;   // The name of the current root member
+        bool m_skipping;     // Whether the current root member is being skipped
+
+        const TopLevelArray* m_topLevelArray;
+        size_t m_topLevelArrayIndex;
+    };
+
+    bool IsSchemaValidationDisabled(SchemaFlags schemaFlags)
+    {
+        return (schemaFlags & SchemaFlags::DisableSchemaRoot) == SchemaFlags::DisableSchemaRoot;
+    }
+
+    template<unsigned parseFlags, typename InputStream>
+    Document DeserializeStreaming(InputStream& inputStream, const DeserializeContext& context, SchemaFlags schemaFlags)
+    {
+        Document gltfDocument;
+        StreamingDeserializer handler(gltfDocument, context);
+
+        rapidjson::Reader reader;
+
+        if (IsSchemaValidationDisabled(schemaFlags))
+        {
+            if (reader.Parse<parseFlags>(inputStream, handler).IsError())
+            {
+                // The input is not valid JSON (or its root isn't an object)
+                throw GLTFException("The document is invalid due to bad JSON formatting");
+            }
+        }
+        else
+        {
+            // Each event is validated before being forwarded to the deserializer, so an element is only deserialized
+            // once it (and everything it contains) has been validated
+            rapidjson::GenericSchemaValidator<rapidjson::SchemaDocument, StreamingDeserializer> schemaValidator(
+                GetDefaultSchemaCache(schemaFlags)->GetSchemaDocument(SCHEMA_URI_GLTF), handler);
+
+            const bool isParseError = reader.Parse<parseFlags>(inputStream, schemaValidator).IsError();
+
+            if (!schemaValidator.IsValid())
+            {
+                ThrowSchemaViolation(schemaValidator);
+            }
+
+            if (isParseError)
+            {
+                throw GLTFException("The document is invalid due to bad JSON formatting");
+            }
+        }
+
+        handler.Finish();
+
+        return gltfDocument;
+    }
+
+    // The manifest is deserialized directly from SAX events unless the schema is to be validated against a DOM of
+    // the whole document
+    bool IsStreaming(DeserializeFlags flags, SchemaFlags schemaFlags)
+    {
+        return IsSchemaValidationDisabled(schemaFlags) || HasFlag(flags, DeserializeFlags::ValidateWhileParsing);
+    }
+
+    // Parses the json into a DOM whose values are allocated from the arena
+    JsonArena::JsonDocument CreateDocument(const std::string& json, DeserializeFlags flags, JsonArena& arena)
+    {
+        JsonArena::JsonDocument document(&arena.GetAllocator(), JsonArena::StackCapacity, &arena.GetStackAllocator());
+
+        if (HasFlag(flags, DeserializeFlags::IgnoreByteOrderMark))
+        {
+            rapidjson::MemoryStream memoryStream(json.c_str(), json.size());
+            rapidjson::EncodedInputStream<rapidjson::UTF8<>, rapidjson::MemoryStream> encodedStream(memoryStream);
+
+            document.ParseStream<rapidjson::kParseDefaultFlags, rapidjson::UTF8<>>(encodedStream);
+        }
+        else
+        {
+            document.Parse(json.c_str());
+        }
+
+        if (document.HasParseError())
+        {
+            // The input is not valid JSON.
+            throw GLTFException("The document is invalid due to bad JSON formatting");
+        }
+
+        return document;
     }
 }
 
@@ -842,11 +1419,50 @@ Document Microsoft::glTF::Deserialize(const std::string& json, DeserializeFlags
 
 Document Microsoft::glTF::Deserialize(const std::string& json, const ExtensionDeserializer& extensionDeserializer, DeserializeFlags flags, SchemaFlags schemaFlags)
 {
+    const DeserializeContext context = { extensionDeserializer, flags };
+
+    if (IsStreaming(flags, schemaFlags))
+    {
+        if (HasFlag(flags, DeserializeFlags::IgnoreByteOrderMark))
+        {
+            rapidjson::MemoryStream memoryStream(json.c_str(), json.size());
+            rapidjson::EncodedInputStream<rapidjson::UTF8<>, rapidjson::MemoryStream> encodedStream(memoryStream);
+
+            return DeserializeStreaming<rapidjson::kParseDefaultFlags>(encodedStream, context, schemaFlags);
+        }
+
+        rapidjson::StringStream stringStream(json.c_str());
+
+        return DeserializeStreaming<rapidjson::kParseDefaultFlags>(stringStream, context, schemaFlags);
+    }
+
     const auto document = HasFlag(flags, DeserializeFlags::IgnoreByteOrderMark) ?
         RapidJsonUtils::CreateDocumentFromEncodedString(json) :
         RapidJsonUtils::CreateDocumentFromString(json);
 
-    return DeserializeInternal(document, extensionDeserializer, schemaFlags);
+    return DeserializeInternal(document, context, schemaFlags);
+}
+
+Document Microsoft::glTF::Deserialize(const std::string& json, JsonArena& arena, DeserializeFlags flags, SchemaFlags schemaFlags)
+{
+    return Deserialize(json, arena, ExtensionDeserializer(), flags, schemaFlags);
+}
+
+Document Microsoft::glTF::Deserialize(const std::string& json, JsonArena& arena, const ExtensionDeserializer& extensionDeserializer, DeserializeFlags flags, SchemaFlags schemaFlags)
+{
+    if (IsStreaming(flags, schemaFlags))
+    {
+        return Deserialize(json, extensionDeserializer, flags, schemaFlags);
+    }
+
+    const DeserializeContext context = { extensionDeserializer, flags };
+
+    // Values allocated for the previous document are discarded
+    arena.Reset();
+
+    const auto document = CreateDocument(json, flags, arena);
+
+    return DeserializeInternal(document, context, schemaFlags);
 }
 
 Document Microsoft::glTF::Deserialize(std::istream& jsonStream, DeserializeFlags flags, SchemaFlags schemaFlags)
@@ -856,11 +1472,70 @@ Document Microsoft::glTF::Deserialize(std::istream& jsonStream, DeserializeFlags
 
 Document Microsoft::glTF::Deserialize(std::istream& jsonStream, const ExtensionDeserializer& extensionDeserializer, DeserializeFlags flags, SchemaFlags schemaFlags)
 {
+    const DeserializeContext context = { extensionDeserializer, flags };
+
+    if (IsStreaming(flags, schemaFlags))
+    {
+        rapidjson::IStreamWrapper streamWrapper(jsonStream);
+
+        if (HasFlag(flags, DeserializeFlags::IgnoreByteOrderMark))
+        {
+            rapidjson::EncodedInputStream<rapidjson::UTF8<>, rapidjson::IStreamWrapper> encodedStream(streamWrapper);
+
+            return DeserializeStreaming<rapidjson::kParseDefaultFlags>(encodedStream, context, schemaFlags);
+        }
+
+        return DeserializeStreaming<rapidjson::kParseDefaultFlags>(streamWrapper, context, schemaFlags);
+    }
+
     const auto document = HasFlag(flags, DeserializeFlags::IgnoreByteOrderMark) ?
         RapidJsonUtils::CreateDocumentFromEncodedStream(jsonStream) :
         RapidJsonUtils::CreateDocumentFromStream(jsonStream);
 
-    return DeserializeInternal(document, extensionDeserializer, schemaFlags);
+    return DeserializeInternal(document, context, schemaFlags);
+}
+
+Document Microsoft::glTF::DeserializeInsitu(char* json, DeserializeFlags flags, SchemaFlags schemaFlags)
+{
+    return DeserializeInsitu(json, ExtensionDeserializer(), flags, schemaFlags);
+}
+
+Document Microsoft::glTF::DeserializeInsitu(char* json, const ExtensionDeserializer& extensionDeserializer, DeserializeFlags flags, SchemaFlags schemaFlags)
+{
+    const DeserializeContext context = { extensionDeserializer, flags };
+
+    // In situ parsing reads the buffer directly (not via an EncodedInputStream) so any UTF-8 byte order mark is skipped here
+    if (HasFlag(flags, DeserializeFlags::IgnoreByteOrderMark) && std::strncmp(json, "\xEF\xBB\xBF", 3) == 0)
+    {
+        json += 3;
+    }
+
+    if (IsStreaming(flags, schemaFlags))
+    {
+        rapidjson::InsituStringStream insituStream(json);
+
+        return DeserializeStreaming<rapidjson::kParseInsituFlag | rapidjson::kParseDefaultFlags>(insituStream, context, schemaFlags);
+    }
+
+    const auto document = RapidJsonUtils::CreateDocumentFromInsituString(json);
+
+    return DeserializeInternal(document, context, schemaFlags);
+}
+
+Document Microsoft::glTF::DeserializeParallel(const std::string& json, IExecutor& executor, DeserializeFlags flags, SchemaFlags schemaFlags)
+{
+    return DeserializeParallel(json, ExtensionDeserializer(), executor, flags, schemaFlags);
+}
+
+Document Microsoft::glTF::DeserializeParallel(const std::string& json, const ExtensionDeserializer& extensionDeserializer, IExecutor& executor, DeserializeFlags flags, SchemaFlags schemaFlags)
+{
+    const DeserializeContext context = { extensionDeserializer, flags };
+
+    const auto document = HasFlag(flags, DeserializeFlags::IgnoreByteOrderMark) ?
+        RapidJsonUtils::CreateDocumentFromEncodedString(json) :
+        RapidJsonUtils::CreateDocumentFromString(json);
+
+    return DeserializeInternalParallel(document, context, schemaFlags, executor);
 }
 
 DeserializeFlags Microsoft::glTF::operator|(DeserializeFlags lhs, DeserializeFlags rhs)
@@ -0,0 +1,1292 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/DocumentSnapshot.h>
+
+#include <GLTFSDK/Exceptions.h>
+#include <GLTFSDK/MemoryStream.h>
+
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <limits>
+#include <type_traits>
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    const char SnapshotMagic[8] = { 'g', 'l', 'T', 'F', 'S', 'N', 'A', 'P' };
+    const uint32_t SnapshotByteOrder = 0x01020304U;
+
+    // Header layout: magic, version, byte order, total length, section count, then an entry per section
+    struct SnapshotSectionEntry
+    {
+        uint32_t id;
+        uint32_t reserved;
+        uint64_t offset;
+        uint64_t length;
+    };
+
+    const size_t SnapshotHeaderSize = sizeof(SnapshotMagic) + 2U * sizeof(uint32_t) + sizeof(uint64_t) + sizeof(uint32_t);
+
+    // Returns whether the value read from a snapshot is one of TEnum's enumerators, checked before the value is
+    // cast to TEnum so a corrupt snapshot can't produce an enum value the rest of the SDK doesn't handle
+    template<typename TEnum>
+    bool IsEnumValue(uint32_t value);
+
+    template<>
+    bool IsEnumValue<BufferViewTarget>(uint32_t value)
+    {
+        return value == ARRAY_BUFFER || value == ELEMENT_ARRAY_BUFFER;
+    }
+
+    template<>
+    bool IsEnumValue<ComponentType>(uint32_t value)
+    {
+        switch (value)
+        {
+        case COMPONENT_UNKNOWN:
+        case COMPONENT_BYTE:
+        case COMPONENT_UNSIGNED_BYTE:
+        case COMPONENT_SHORT:
+        case COMPONENT_UNSIGNED_SHORT:
+        case COMPONENT_UNSIGNED_INT:
+        case COMPONENT_FLOAT:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    template<>
+    bool IsEnumValue<AccessorType>(uint32_t value)
+    {
+        return value <= TYPE_MAT4;
+    }
+
+    template<>
+    bool IsEnumValue<MeshMode>(uint32_t value)
+    {
+        return value <= MESH_TRIANGLE_FAN;
+    }
+
+    template<>
+    bool IsEnumValue<AlphaMode>(uint32_t value)
+    {
+        return value <= ALPHA_MASK;
+    }
+
+    template<>
+    bool IsEnumValue<TargetPath>(uint32_t value)
+    {
+        return value <= TARGET_WEIGHTS;
+    }
+
+    template<>
+    bool IsEnumValue<InterpolationType>(uint32_t value)
+    {
+        return value <= INTERPOLATION_CUBICSPLINE;
+    }
+
+    template<>
+    bool IsEnumValue<ProjectionType>(uint32_t value)
+    {
+        return value <= PROJECTION_ORTHOGRAPHIC;
+    }
+
+    template<>
+    bool IsEnumValue<MagFilterMode>(uint32_t value)
+    {
+        return value == MagFilter_NEAREST || value == MagFilter_LINEAR;
+    }
+
+    template<>
+    bool IsEnumValue<MinFilterMode>(uint32_t value)
+    {
+        switch (value)
+        {
+        case MinFilter_NEAREST:
+        case MinFilter_LINEAR:
+        case MinFilter_NEAREST_MIPMAP_NEAREST:
+        case MinFilter_LINEAR_MIPMAP_NEAREST:
+        case MinFilter_NEAREST_MIPMAP_LINEAR:
+        case MinFilter_LINEAR_MIPMAP_LINEAR:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    template<>
+    bool IsEnumValue<WrapMode>(uint32_t value)
+    {
+        return value == Wrap_REPEAT || value == Wrap_CLAMP_TO_EDGE || value == Wrap_MIRRORED_REPEAT;
+    }
+
+    class SnapshotWriter
+    {
+    public:
+        SnapshotWriter(std::vector<uint8_t>& data, const Document& document, const ExtensionSerializer& extensionSerializer) :
+            m_data(data),
+            m_document(document),
+            m_extensionSerializer(extensionSerializer)
+        {
+        }
+
+        void WriteBytes(const void* data, size_t byteLength)
+        {
+            const auto bytes = static_cast<const uint8_t*>(data);
+            m_data.insert(m_data.end(), bytes, bytes + byteLength);
+        }
+
+        template<typename T>
+        void Write(T value)
+        {
+            static_assert(std::is_arithmetic<T>::value, "Only arithmetic values can be written directly");
+            WriteBytes(&value, sizeof(T));
+        }
+
+        // size_t values are always stored as 64 bits so snapshots are independent of the platform's word size
+        void WriteSize(size_t value)
+        {
+            Write<uint64_t>(value);
+        }
+
+        template<typename TEnum>
+        void WriteEnum(TEnum value)
+        {
+            Write<uint32_t>(static_cast<uint32_t>(value));
+        }
+
+        void WriteString(const std::string& value)
+        {
+            WriteSize(value.size());
+            WriteBytes(value.data(), value.size());
+        }
+
+        void WriteStrings(const std::vector<std::string>& values)
+        {
+            WriteSize(values.size());
+
+            for (const auto& value : values)
+            {
+                WriteString(value);
+            }
+        }
+
+        void WriteFloats(const std::vector<float>& values)
+        {
+            WriteSize(values.size());
+            WriteBytes(values.data(), values.size() * sizeof(float));
+        }
+
+        template<typename T>
+        void WriteOptionalEnum(const Optional<T>& value)
+        {
+            Write<uint8_t>(value.HasValue());
+
+            if (value)
+            {
+                WriteEnum(value.Get());
+            }
+        }
+
+        void WriteOptional(const Optional<size_t>& value)
+        {
+            Write<uint8_t>(value.HasValue());
+
+            if (value)
+            {
+                WriteSize(value.Get());
+            }
+        }
+
+        void WriteOptional(const Optional<float>& value)
+        {
+            Write<uint8_t>(value.HasValue());
+
+            if (value)
+            {
+                Write(value.Get());
+            }
+        }
+
+        // Registered extensions are written as the name and json string produced by their ExtensionSerializer handler
+        void WriteExtension(const Extension& extension, const glTFProperty& property)
+        {
+            const auto extensionPair = m_extensionSerializer.Serialize(extension, property, m_document);
+
+            WriteString(extensionPair.name);
+            WriteString(extensionPair.value);
+        }
+
+    private:
+        std::vector<uint8_t>& m_data;
+
+        const Document& m_document;
+        const ExtensionSerializer& m_extensionSerializer;
+    };
+
+    class SnapshotReader
+    {
+    public:
+        SnapshotReader(const uint8_t* data, size_t byteLength, const ExtensionDeserializer& extensionDeserializer) :
+            m_data(data),
+            m_byteLength(byteLength),
+            m_position(0U),
+            m_extensionDeserializer(extensionDeserializer)
+        {
+        }
+
+        const uint8_t* ReadBytes(size_t byteLength)
+        {
+            if (byteLength > m_byteLength - m_position)
+            {
+                throw GLTFException("The snapshot is truncated or corrupt");
+            }
+
+            const auto bytes = m_data + m_position;
+            m_position += byteLength;
+            return bytes;
+        }
+
+        void ReadBytes(void* data, size_t byteLength)
+        {
+            std::memcpy(data, ReadBytes(byteLength), byteLength);
+        }
+
+        template<typename T>
+        T Read()
+        {
+            static_assert(std::is_arithmetic<T>::value, "Only arithmetic values can be read directly");
+
+            T value;
+            ReadBytes(&value, sizeof(T));
+            return value;
+        }
+
+        size_t ReadSize()
+        {
+            const auto value = Read<uint64_t>();
+
+            if (value > std::numeric_limits<size_t>::max())
+            {
+                throw GLTFException("The snapshot is truncated or corrupt");
+            }
+
+            return static_cast<size_t>(value);
+        }
+
+        // Reads the number of following elements - each occupies at least elementSize bytes, so a corrupt count can
+        // be detected before any memory is allocated for the elements
+        size_t ReadCount(size_t elementSize = 1U)
+        {
+            const auto count = ReadSize();
+
+            if (count > (m_byteLength - m_position) / elementSize)
+            {
+                throw GLTFException("The snapshot is truncated or corrupt");
+            }
+
+            return count;
+        }
+
+        template<typename TEnum>
+        TEnum ReadEnum()
+        {
+            const auto value = Read<uint32_t>();
+
+            if (!IsEnumValue<TEnum>(value))
+            {
+                throw GLTFException("The snapshot contains an invalid enum value " + std::to_string(value));
+            }
+
+            return static_cast<TEnum>(value);
+        }
+
+        std::string ReadString()
+        {
+            const auto length = ReadSize();
+            return std::string(reinterpret_cast<const char*>(ReadBytes(length)), length);
+        }
+
+        std::vector<std::string> ReadStrings()
+        {
+            std::vector<std::string> values(ReadCount(sizeof(uint64_t)));
+
+            for (auto& value : values)
+            {
+                value = ReadString();
+            }
+
+            return values;
+        }
+
+        std::vector<float> ReadFloats()
+        {
+            std::vector<float> values(ReadCount(sizeof(float)));
+            ReadBytes(values.data(), values.size() * sizeof(float));
+            return values;
+        }
+
+        template<typename T>
+        Optional<T> ReadOptionalEnum()
+        {
+            if (Read<uint8_t>())
+            {
+                return ReadEnum<T>();
+            }
+
+            return {};
+        }
+
+        Optional<size_t> ReadOptionalSize()
+        {
+            if (Read<uint8_t>())
+            {
+                return ReadSize();
+            }
+
+            return {};
+        }
+
+        Optional<float> ReadOptionalFloat()
+        {
+            if (Read<uint8_t>())
+            {
+                return Read<float>();
+            }
+
+            return {};
+        }
+
+        // As with Deserialize, extensions without a registered ExtensionDeserializer handler are stored in
+        // glTFProperty::extensions as their json strings
+        void ReadExtension(glTFProperty& property)
+        {
+            ExtensionPair extensionPair;
+
+            extensionPair.name = ReadString();
+            extensionPair.value = ReadString();
+
+            if (m_extensionDeserializer.HasHandler(extensionPair.name, property) ||
+                m_extensionDeserializer.HasHandler(extensionPair.name))
+            {
+                property.SetExtension(m_extensionDeserializer.Deserialize(extensionPair, property));
+            }
+            else
+            {
+                property.extensions.emplace(std::move(extensionPair.name), std::move(extensionPair.value));
+            }
+        }
+
+        bool IsEnd() const
+        {
+            return m_position == m_byteLength;
+        }
+
+    private:
+        const uint8_t* m_data;
+        size_t m_byteLength;
+        size_t m_position;
+
+        const ExtensionDeserializer& m_extensionDeserializer;
+    };
+
+    // glTFProperty
+
+    void WriteProperty(SnapshotWriter& writer, const glTFProperty& property)
+    {
+        writer.WriteSize(property.extensions.size());
+
+        for (const auto& extension : property.extensions)
+        {
+            writer.WriteString(extension.first);
+            writer.WriteString(extension.second);
+        }
+
+        const auto registeredExtensions = property.GetExtensions();
+
+        writer.WriteSize(registeredExtensions.size());
+
+        for (const Extension& extension : registeredExtensions)
+        {
+            writer.WriteExtension(extension, property);
+        }
+
+        writer.WriteString(property.extras);
+    }
+
+    void ReadProperty(SnapshotReader& reader, glTFProperty& property)
+    {
+        const auto count = reader.ReadCount(2U * sizeof(uint64_t));
+
+        property.extensions.reserve(count);
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+            auto name = reader.ReadString();
+            property.extensions.emplace(std::move(name), reader.ReadString());
+        }
+
+        const auto registeredCount = reader.ReadCount(2U * sizeof(uint64_t));
+
+        for (size_t i = 0U; i < registeredCount; ++i)
+        {
+            reader.ReadExtension(property);
+        }
+
+        property.extras = reader.ReadString();
+    }
+
+    void WriteChildOfRootProperty(SnapshotWriter& writer, const glTFChildOfRootProperty& property)
+    {
+        writer.WriteString(property.id);
+        writer.WriteString(property.name);
+
+        WriteProperty(writer, property);
+    }
+
+    void ReadChildOfRootProperty(SnapshotReader& reader, glTFChildOfRootProperty& property)
+    {
+        property.id = reader.ReadString();
+        property.name = reader.ReadString();
+
+        ReadProperty(reader, property);
+    }
+
+    // Accessor
+
+    void WriteAccessor(SnapshotWriter& writer, const Accessor& accessor)
+    {
+        WriteChildOfRootProperty(writer, accessor);
+
+        writer.WriteString(accessor.bufferViewId);
+        writer.WriteSize(accessor.byteOffset);
+        writer.WriteEnum(accessor.componentType);
+        writer.Write<uint8_t>(accessor.normalized);
+        writer.WriteSize(accessor.count);
+        writer.WriteEnum(accessor.type);
+        writer.WriteFloats(accessor.max);
+        writer.WriteFloats(accessor.min);
+
+        writer.WriteSize(accessor.sparse.count);
+        writer.WriteString(accessor.sparse.indicesBufferViewId);
+        writer.WriteEnum(accessor.sparse.indicesComponentType);
+        writer.WriteSize(accessor.sparse.indicesByteOffset);
+        writer.WriteString(accessor.sparse.valuesBufferViewId);
+        writer.WriteSize(accessor.sparse.valuesByteOffset);
+    }
+
+    Accessor ReadAccessor(SnapshotReader& reader)
+    {
+        Accessor accessor;
+
+        ReadChildOfRootProperty(reader, accessor);
+
+        accessor.bufferViewId = reader.ReadString();
+        accessor.byteOffset = reader.ReadSize();
+        accessor.componentType = reader.ReadEnum<ComponentType>();
+        accessor.normalized = reader.Read<uint8_t>() != 0U;
+        accessor.count = reader.ReadSize();
+        accessor.type = reader.ReadEnum<AccessorType>();
+        accessor.max = reader.ReadFloats();
+        accessor.min = reader.ReadFloats();
+
+        accessor.sparse.count = reader.ReadSize();
+        accessor.sparse.indicesBufferViewId = reader.ReadString();
+        accessor.sparse.indicesComponentType = reader.ReadEnum<ComponentType>();
+        accessor.sparse.indicesByteOffset = reader.ReadSize();
+        accessor.sparse.valuesBufferViewId = reader.ReadString();
+        accessor.sparse.valuesByteOffset = reader.ReadSize();
+
+        return accessor;
+    }
+
+    // Animation
+
+    void WriteAnimation(SnapshotWriter& writer, const Animation& animation)
+    {
+        WriteChildOfRootProperty(writer, animation);
+
+        writer.WriteSize(animation.channels.Size());
+
+        for (const auto& channel : animation.channels.Elements())
+        {
+            WriteProperty(writer, channel);
+
+            writer.WriteString(channel.id);
+            writer.WriteString(channel.samplerId);
+
+            WriteProperty(writer, channel.target);
+
+            writer.WriteString(channel.target.nodeId);
+            writer.WriteEnum(channel.target.path);
+        }
+
+        writer.WriteSize(animation.samplers.Size());
+
+        for (const auto& sampler : animation.samplers.Elements())
+        {
+            WriteProperty(writer, sampler);
+
+            writer.WriteString(sampler.id);
+            writer.WriteString(sampler.inputAccessorId);
+            writer.WriteEnum(sampler.interpolation);
+            writer.WriteString(sampler.outputAccessorId);
+        }
+    }
+
+    Animation ReadAnimation(SnapshotReader& reader)
+    {
+        Animation animation;
+
+        ReadChildOfRootProperty(reader, animation);
+
+        const auto channelCount = reader.ReadCount();
+        animation.channels.Reserve(channelCount);
+
+        for (size_t i = 0U; i < channelCount; ++i)
+        {
+            AnimationChannel channel;
+
+            ReadProperty(reader, channel);
+
+            channel.id = reader.ReadString();
+            channel.samplerId = reader.ReadString();
+
+            ReadProperty(reader, channel.target);
+
+            channel.target.nodeId = reader.ReadString();
+            channel.target.path = reader.ReadEnum<TargetPath>();
+
+            animation.channels.Append(std::move(channel));
+        }
+
+        const auto samplerCount = reader.ReadCount();
+        animation.samplers.Reserve(samplerCount);
+
+        for (size_t i = 0U; i < samplerCount; ++i)
+        {
+            AnimationSampler sampler;
+
+            ReadProperty(reader, sampler);
+
+            sampler.id = reader.ReadString();
+            sampler.inputAccessorId = reader.ReadString();
+            sampler.interpolation = reader.ReadEnum<InterpolationType>();
+            sampler.outputAccessorId = reader.ReadString();
+
+            animation.samplers.Append(std::move(sampler));
+        }
+
+        return animation;
+    }
+
+    // Buffer
+
+    void WriteBuffer(SnapshotWriter& writer, const Buffer& buffer)
+    {
+        WriteChildOfRootProperty(writer, buffer);
+
+        writer.WriteString(buffer.uri);
+        writer.WriteSize(buffer.byteLength);
+    }
+
+    Buffer ReadBuffer(SnapshotReader& reader)
+    {
+        Buffer buffer;
+
+        ReadChildOfRootProperty(reader, buffer);
+
+        buffer.uri = reader.ReadString();
+        buffer.byteLength = reader.ReadSize();
+
+        return buffer;
+    }
+
+    // BufferView
+
+    void WriteBufferView(SnapshotWriter& writer, const BufferView& bufferView)
+    {
+        WriteChildOfRootProperty(writer, bufferView);
+
+        writer.WriteString(bufferView.bufferId);
+        writer.WriteSize(bufferView.byteOffset);
+        writer.WriteSize(bufferView.byteLength);
+        writer.WriteOptional(bufferView.byteStride);
+        writer.WriteOptionalEnum(bufferView.target);
+    }
+
+    BufferView ReadBufferView(SnapshotReader& reader)
+    {
+        BufferView bufferView;
+
+        ReadChildOfRootProperty(reader, bufferView);
+
+        bufferView.bufferId = reader.ReadString();
+        bufferView.byteOffset = reader.ReadSize();
+        bufferView.byteLength = reader.ReadSize();
+        bufferView.byteStride = reader.ReadOptionalSize();
+        bufferView.target = reader.ReadOptionalEnum<BufferViewTarget>();
+
+        return bufferView;
+    }
+
+    // Camera
+
+    // A Camera can't be constructed without its projection so the projection is written first
+    void WriteCamera(SnapshotWriter& writer, const Camera& camera)
+    {
+        const auto projectionType = camera.projection->GetProjectionType();
+
+        writer.WriteEnum(projectionType);
+
+        if (projectionType == PROJECTION_PERSPECTIVE)
+        {
+            const auto& perspective = camera.GetPerspective();
+
+            writer.Write(perspective.znear);
+            writer.WriteOptional(perspective.aspectRatio);
+            writer.Write(perspective.yfov);
+            writer.WriteOptional(perspective.zfar);
+        }
+        else
+        {
+            const auto& orthographic = camera.GetOrthographic();
+
+            writer.Write(orthographic.znear);
+            writer.Write(orthographic.xmag);
+            writer.Write(orthographic.ymag);
+            writer.Write(orthographic.zfar);
+        }
+
+        WriteProperty(writer, *camera.projection);
+        WriteChildOfRootProperty(writer, camera);
+    }
+
+    std::unique_ptr<Projection> ReadProjection(SnapshotReader& reader)
+    {
+        const auto projectionType = reader.ReadEnum<ProjectionType>();
+        const auto znear = reader.Read<float>();
+
+        if (projectionType == PROJECTION_PERSPECTIVE)
+        {
+            const auto aspectRatio = reader.ReadOptionalFloat();
+            const auto yfov = reader.Read<float>();
+
+            auto perspective = std::make_unique<Perspective>(znear, yfov);
+            perspective->aspectRatio = aspectRatio;
+            perspective->zfar = reader.ReadOptionalFloat();
+
+            return perspective;
+        }
+
+        if (projectionType == PROJECTION_ORTHOGRAPHIC)
+        {
+            const auto xmag = reader.Read<float>();
+            const auto ymag = reader.Read<float>();
+            const auto zfar = reader.Read<float>();
+
+            return std::make_unique<Orthographic>(zfar, znear, xmag, ymag);
+        }
+
+        throw GLTFException("The snapshot is truncated or corrupt");
+    }
+
+    Camera ReadCamera(SnapshotReader& reader)
+    {
+        Camera camera(ReadProjection(reader));
+
+        ReadProperty(reader, *camera.projection);
+        ReadChildOfRootProperty(reader, camera);
+
+        return camera;
+    }
+
+    // Image
+
+    void WriteImage(SnapshotWriter& writer, const Image& image)
+    {
+        WriteChildOfRootProperty(writer, image);
+
+        writer.WriteString(image.uri);
+        writer.WriteString(image.mimeType);
+        writer.WriteString(image.bufferViewId);
+    }
+
+    Image ReadImage(SnapshotReader& reader)
+    {
+        Image image;
+
+        ReadChildOfRootProperty(reader, image);
+
+        image.uri = reader.ReadString();
+        image.mimeType = reader.ReadString();
+        image.bufferViewId = reader.ReadString();
+
+        return image;
+    }
+
+    // Material
+
+    void WriteTextureInfo(SnapshotWriter& writer, const TextureInfo& textureInfo)
+    {
+        WriteProperty(writer, textureInfo);
+
+        writer.WriteString(textureInfo.textureId);
+        writer.WriteSize(textureInfo.texCoord);
+    }
+
+    void ReadTextureInfo(SnapshotReader& reader, TextureInfo& textureInfo)
+    {
+        ReadProperty(reader, textureInfo);
+
+        textureInfo.textureId = reader.ReadString();
+        textureInfo.texCoord = reader.ReadSize();
+    }
+
+    void WriteMaterial(SnapshotWriter& writer, const Material& material)
+    {
+        WriteChildOfRootProperty(writer, material);
+
+        WriteProperty(writer, material.metallicRoughness);
+
+        writer.Write(material.metallicRoughness.baseColorFactor.r);
+        writer.Write(material.metallicRoughness.baseColorFactor.g);
+        writer.Write(material.metallicRoughness.baseColorFactor.b);
+        writer.Write(material.metallicRoughness.baseColorFactor.a);
+        WriteTextureInfo(writer, material.metallicRoughness.baseColorTexture);
+        writer.Write(material.metallicRoughness.metallicFactor);
+        writer.Write(material.metallicRoughness.roughnessFactor);
+        WriteTextureInfo(writer, material.metallicRoughness.metallicRoughnessTexture);
+
+        WriteTextureInfo(writer, material.normalTexture);
+        writer.Write(material.normalTexture.scale);
+
+        WriteTextureInfo(writer, material.occlusionTexture);
+        writer.Write(material.occlusionTexture.strength);
+
+        WriteTextureInfo(writer, material.emissiveTexture);
+
+        writer.Write(material.emissiveFactor.r);
+        writer.Write(material.emissiveFactor.g);
+        writer.Write(material.emissiveFactor.b);
+        writer.WriteEnum(material.alphaMode);
+        writer.Write(material.alphaCutoff);
+        writer.Write<uint8_t>(material.doubleSided);
+    }
+
+    Material ReadMaterial(SnapshotReader& reader)
+    {
+        Material material;
+
+        ReadChildOfRootProperty(reader, material);
+
+        ReadProperty(reader, material.metallicRoughness);
+
+        material.metallicRoughness.baseColorFactor.r = reader.Read<float>();
+        material.metallicRoughness.baseColorFactor.g = reader.Read<float>();
+        material.metallicRoughness.baseColorFactor.b = reader.Read<float>();
+        material.metallicRoughness.baseColorFactor.a = reader.Read<float>();
+        ReadTextureInfo(reader, material.metallicRoughness.baseColorTexture);
+        material.metallicRoughness.metallicFactor = reader.Read<float>();
+        material.metallicRoughness.roughnessFactor = reader.Read<float>();
+        ReadTextureInfo(reader, material.metallicRoughness.metallicRoughnessTexture);
+
+        ReadTextureInfo(reader, material.normalTexture);
+        material.normalTexture.scale = reader.Read<float>();
+
+        ReadTextureInfo(reader, material.occlusionTexture);
+        material.occlusionTexture.strength = reader.Read<float>();
+
+        ReadTextureInfo(reader, material.emissiveTexture);
+
+        material.emissiveFactor.r = reader.Read<float>();
+        material.emissiveFactor.g = reader.Read<float>();
+        material.emissiveFactor.b = reader.Read<float>();
+        material.alphaMode = reader.ReadEnum<AlphaMode>();
+        material.alphaCutoff = reader.Read<float>();
+        material.doubleSided = reader.Read<uint8_t>() != 0U;
+
+        return material;
+    }
+
+    // Mesh
+
+    void WriteMesh(SnapshotWriter& writer, const Mesh& mesh)
+    {
+        WriteChildOfRootProperty(writer, mesh);
+
+        writer.WriteSize(mesh.primitives.size());
+
+        for (const auto& primitive : mesh.primitives)
+        {
+            WriteProperty(writer, primitive);
+
+            writer.WriteSize(primitive.attributes.size());
+
+            for (const auto& attribute : primitive.attributes)
+            {
+                writer.WriteString(attribute.first);
+                writer.WriteString(attribute.second);
+            }
+
+            writer.WriteString(primitive.indicesAccessorId);
+            writer.WriteString(primitive.materialId);
+            writer.WriteEnum(primitive.mode);
+
+            writer.WriteSize(primitive.targets.size());
+
+            for (const auto& target : primitive.targets)
+            {
+                writer.WriteString(target.positionsAccessorId);
+                writer.WriteString(target.normalsAccessorId);
+                writer.WriteString(target.tangentsAccessorId);
+            }
+        }
+
+        writer.WriteFloats(mesh.weights);
+    }
+
+    Mesh ReadMesh(SnapshotReader& reader)
+    {
+        Mesh mesh;
+
+        ReadChildOfRootProperty(reader, mesh);
+
+        mesh.primitives.resize(reader.ReadCount());
+
+        for (auto& primitive : mesh.primitives)
+        {
+            ReadProperty(reader, primitive);
+
+            const auto attributeCount = reader.ReadCount(2U * sizeof(uint64_t));
+
+            primitive.attributes.reserve(attributeCount);
+
+            for (size_t i = 0U; i < attributeCount; ++i)
+            {
+                auto name = reader.ReadString();
+                primitive.attributes.emplace(std::move(name), reader.ReadString());
+            }
+
+            primitive.indicesAccessorId = reader.ReadString();
+            primitive.materialId = reader.ReadString();
+            primitive.mode = reader.ReadEnum<MeshMode>();
+
+            primitive.targets.resize(reader.ReadCount(3U * sizeof(uint64_t)));
+
+            for (auto& target : primitive.targets)
+            {
+                target.positionsAccessorId = reader.ReadString();
+                target.normalsAccessorId = reader.ReadString();
+                target.tangentsAccessorId = reader.ReadString();
+            }
+        }
+
+        mesh.weights = reader.ReadFloats();
+
+        return mesh;
+    }
+
+    // Node
+
+    void WriteNode(SnapshotWriter& writer, const Node& node)
+    {
+        WriteChildOfRootProperty(writer, node);
+
+        writer.WriteString(node.cameraId);
+        writer.WriteStrings(node.children);
+        writer.WriteString(node.skinId);
+        writer.WriteBytes(node.matrix.values.data(), sizeof(node.matrix.values));
+        writer.WriteString(node.meshId);
+        writer.Write(node.rotation.x);
+        writer.Write(node.rotation.y);
+        writer.Write(node.rotation.z);
+        writer.Write(node.rotation.w);
+        writer.Write(node.scale.x);
+        writer.Write(node.scale.y);
+        writer.Write(node.scale.z);
+        writer.Write(node.translation.x);
+        writer.Write(node.translation.y);
+        writer.Write(node.translation.z);
+        writer.WriteFloats(node.weights);
+    }
+
+    Node ReadNode(SnapshotReader& reader)
+    {
+        Node node;
+
+        ReadChildOfRootProperty(reader, node);
+
+        node.cameraId = reader.ReadString();
+        node.children = reader.ReadStrings();
+        node.skinId = reader.ReadString();
+        reader.ReadBytes(node.matrix.values.data(), sizeof(node.matrix.values));
+        node.meshId = reader.ReadString();
+        node.rotation.x = reader.Read<float>();
+        node.rotation.y = reader.Read<float>();
+        node.rotation.z = reader.Read<float>();
+        node.rotation.w = reader.Read<float>();
+        node.scale.x = reader.Read<float>();
+        node.scale.y = reader.Read<float>();
+        node.scale.z = reader.Read<float>();
+        node.translation.x = reader.Read<float>();
+        node.translation.y = reader.Read<float>();
+        node.translation.z = reader.Read<float>();
+        node.weights = reader.ReadFloats();
+
+        return node;
+    }
+
+    // Sampler
+
+    void WriteSampler(SnapshotWriter& writer, const Sampler& sampler)
+    {
+        WriteChildOfRootProperty(writer, sampler);
+
+        writer.WriteOptionalEnum(sampler.magFilter);
+        writer.WriteOptionalEnum(sampler.minFilter);
+        writer.WriteEnum(sampler.wrapS);
+        writer.WriteEnum(sampler.wrapT);
+    }
+
+    Sampler ReadSampler(SnapshotReader& reader)
+    {
+        Sampler sampler;
+
+        ReadChildOfRootProperty(reader, sampler);
+
+        sampler.magFilter = reader.ReadOptionalEnum<MagFilterMode>();
+        sampler.minFilter = reader.ReadOptionalEnum<MinFilterMode>();
+        sampler.wrapS = reader.ReadEnum<WrapMode>();
+        sampler.wrapT = reader.ReadEnum<WrapMode>();
+
+        return sampler;
+    }
+
+    // Scene
+
+    void WriteScene(SnapshotWriter& writer, const Scene& scene)
+    {
+        WriteChildOfRootProperty(writer, scene);
+
+        writer.WriteStrings(scene.nodes);
+    }
+
+    Scene ReadScene(SnapshotReader& reader)
+    {
+        Scene scene;
+
+        ReadChildOfRootProperty(reader, scene);
+
+        scene.nodes = reader.ReadStrings();
+
+        return scene;
+    }
+
+    // Skin
+
+    void WriteSkin(SnapshotWriter& writer, const Skin& skin)
+    {
+        WriteChildOfRootProperty(writer, skin);
+
+        writer.WriteString(skin.inverseBindMatricesAccessorId);
+        writer.WriteString(skin.skeletonId);
+        writer.WriteStrings(skin.jointIds);
+    }
+
+    Skin ReadSkin(SnapshotReader& reader)
+    {
+        Skin skin;
+
+        ReadChildOfRootProperty(reader, skin);
+
+        skin.inverseBindMatricesAccessorId = reader.ReadString();
+        skin.skeletonId = reader.ReadString();
+        skin.jointIds = reader.ReadStrings();
+
+        return skin;
+    }
+
+    // Texture
+
+    void WriteTexture(SnapshotWriter& writer, const Texture& texture)
+    {
+        WriteChildOfRootProperty(writer, texture);
+
+        writer.WriteString(texture.samplerId);
+        writer.WriteString(texture.imageId);
+    }
+
+    Texture ReadTexture(SnapshotReader& reader)
+    {
+        Texture texture;
+
+        ReadChildOfRootProperty(reader, texture);
+
+        texture.samplerId = reader.ReadString();
+        texture.imageId = reader.ReadString();
+
+        return texture;
+    }
+
+    // Document
+
+    void WriteStringSet(SnapshotWriter& writer, const std::unordered_set<std::string>& values)
+    {
+        writer.WriteSize(values.size());
+
+        for (const auto& value : values)
+        {
+            writer.WriteString(value);
+        }
+    }
+
+    std::unordered_set<std::string> ReadStringSet(SnapshotReader& reader)
+    {
+        const auto count = reader.ReadCount(sizeof(uint64_t));
+
+        std::unordered_set<std::string> values(count);
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+            values.insert(reader.ReadString());
+        }
+
+        return values;
+    }
+
+    void WriteRoot(SnapshotWriter& writer, const Document& document)
+    {
+        WriteProperty(writer, document.asset);
+
+        writer.WriteString(document.asset.copyright);
+        writer.WriteString(document.asset.generator);
+        writer.WriteString(document.asset.version);
+        writer.WriteString(document.asset.minVersion);
+
+        WriteProperty(writer, document);
+
+        WriteStringSet(writer, document.extensionsUsed);
+        WriteStringSet(writer, document.extensionsRequired);
+
+        writer.WriteString(document.defaultSceneId);
+    }
+
+    void ReadRoot(SnapshotReader& reader, Document& document)
+    {
+        ReadProperty(reader, document.asset);
+
+        document.asset.copyright = reader.ReadString();
+        document.asset.generator = reader.ReadString();
+        document.asset.version = reader.ReadString();
+        document.asset.minVersion = reader.ReadString();
+
+        ReadProperty(reader, document);
+
+        document.extensionsUsed = ReadStringSet(reader);
+        document.extensionsRequired = ReadStringSet(reader);
+
+        document.defaultSceneId = reader.ReadString();
+    }
+
+    template<typename T, IndexedContainer<const T> Document::* Container, void (*Write)(SnapshotWriter&, const T&)>
+    void WriteContainer(SnapshotWriter& writer, const Document& document)
+    {
+        const auto& container = document.*Container;
+
+        writer.WriteSize(container.Size());
+
+        for (const auto& element : container.Elements())
+        {
+            Write(writer, element);
+        }
+    }
+
+    template<typename T, IndexedContainer<const T> Document::* Container, T (*Read)(SnapshotReader&)>
+    void ReadContainer(SnapshotReader& reader, Document& document)
+    {
+        auto& container = document.*Container;
+
+        const auto count = reader.ReadCount();
+        container.Reserve(count);
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+            container.Append(Read(reader));
+        }
+    }
+
+    // Each section is written and read independently, from its own offset within the snapshot. Sections are
+    // identified by index so new sections can only be appended (and SNAPSHOT_VERSION incremented).
+    struct SnapshotSection
+    {
+        void (*write)(SnapshotWriter&, const Document&);
+        void (*read)(SnapshotReader&, Document&);
+    };
+
+    const SnapshotSection SnapshotSections[] = {
+        { WriteRoot, ReadRoot },
+        { WriteContainer<Accessor, &Document::accessors, WriteAccessor>, ReadContainer<Accessor, &Document::accessors, ReadAccessor> },
+        { WriteContainer<Animation, &Document::animations, WriteAnimation>, ReadContainer<Animation, &Document::animations, ReadAnimation> },
+        { WriteContainer<Buffer, &Document::buffers, WriteBuffer>, ReadContainer<Buffer, &Document::buffers, ReadBuffer> },
+        { WriteContainer<BufferView, &Document::bufferViews, WriteBufferView>, ReadContainer<BufferView, &Document::bufferViews, ReadBufferView> },
+        { WriteContainer<Camera, &Document::cameras, WriteCamera>, ReadContainer<Camera, &Document::cameras, ReadCamera> },
+        { WriteContainer<Image, &Document::images, WriteImage>, ReadContainer<Image, &Document::images, ReadImage> },
+        { WriteContainer<Material, &Document::materials, WriteMaterial>, ReadContainer<Material, &Document::materials, ReadMaterial> },
+        { WriteContainer<Mesh, &Document::meshes, WriteMesh>, ReadContainer<Mesh, &Document::meshes, ReadMesh> },
+        { WriteContainer<Node, &Document::nodes, WriteNode>, ReadContainer<Node, &Document::nodes, ReadNode> },
+        { WriteContainer<Sampler, &Document::samplers, WriteSampler>, ReadContainer<Sampler, &Document::samplers, ReadSampler> },
+        { WriteContainer<Scene, &Document::scenes, WriteScene>, ReadContainer<Scene, &Document::scenes, ReadScene> },
+        { WriteContainer<Skin, &Document::skins, WriteSkin>, ReadContainer<Skin, &Document::skins, ReadSkin> },
+        { WriteContainer<Texture, &Document::textures, WriteTexture>, ReadContainer<Texture, &Document::textures, ReadTexture> }
+    };
+
+    const uint32_t SnapshotSectionCount = static_cast<uint32_t>(sizeof(SnapshotSections) / sizeof(SnapshotSections[0]));
+}
+
+std::vector<uint8_t> Microsoft::glTF::CreateSnapshot(const Document& document)
+{
+    return CreateSnapshot(document, ExtensionSerializer());
+}
+
+std::vector<uint8_t> Microsoft::glTF::CreateSnapshot(const Document& document, const ExtensionSerializer& extensionSerializer)
+{
+    std::vector<uint8_t> data;
+    SnapshotWriter writer(data, document, extensionSerializer);
+
+    writer.WriteBytes(SnapshotMagic, sizeof(SnapshotMagic));
+    writer.Write(SNAPSHOT_VERSION);
+    writer.Write(SnapshotByteOrder);
+    writer.Write<uint64_t>(0U); // The total length is known once all sections have been written
+    writer.Write(SnapshotSectionCount);
+
+    const size_t sectionTableOffset = data.size();
+    data.resize(sectionTableOffset + SnapshotSectionCount * sizeof(SnapshotSectionEntry));
+
+    for (uint32_t i = 0U; i < SnapshotSectionCount; ++i)
+    {
+        SnapshotSectionEntry entry = {};
+
+        entry.id = i;
+        entry.offset = data.size();
+
+        SnapshotSections[i].write(writer, document);
+
+        entry.length = data.size() - entry.offset;
+
+        std::memcpy(data.data() + sectionTableOffset + i * sizeof(SnapshotSectionEntry), &entry, sizeof(entry));
+    }
+
+    const uint64_t byteLength = data.size();
+    std::memcpy(data.data() + sizeof(SnapshotMagic) + 2U * sizeof(uint32_t), &byteLength, sizeof(byteLength));
+
+    return data;
+}
+
+void Microsoft::glTF::WriteSnapshot(const Document& document, std::ostream& stream)
+{
+    WriteSnapshot(document, stream, ExtensionSerializer());
+}
+
+void Microsoft::glTF::WriteSnapshot(const Document& document, std::ostream& stream, const ExtensionSerializer& extensionSerializer)
+{
+    const auto data = CreateSnapshot(document, extensionSerializer);
+
+    stream.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+
+    if (stream.fail())
+    {
+        throw GLTFException("Failed to write the snapshot to the stream");
+    }
+}
+
+Document Microsoft::glTF::LoadSnapshot(const uint8_t* data, size_t byteLength)
+{
+    return LoadSnapshot(data, byteLength, ExtensionDeserializer());
+}
+
+Document Microsoft::glTF::LoadSnapshot(const uint8_t* data, size_t byteLength, const ExtensionDeserializer& extensionDeserializer)
+{
+    SnapshotReader headerReader(data, byteLength, extensionDeserializer);
+
+    if (byteLength < SnapshotHeaderSize || std::memcmp(headerReader.ReadBytes(sizeof(SnapshotMagic)), SnapshotMagic, sizeof(SnapshotMagic)) != 0)
+    {
+        throw GLTFException("The data is not a glTF document snapshot");
+    }
+
+    const auto version = headerReader.Read<uint32_t>();
+
+    if (version != SNAPSHOT_VERSION)
+    {
+        throw GLTFException("Unsupported snapshot version " + std::to_string(version) + ", expected version " + std::to_string(SNAPSHOT_VERSION));
+    }
+
+    if (headerReader.Read<uint32_t>() != SnapshotByteOrder)
+    {
+        throw GLTFException("The snapshot was created on a machine with a different byte order");
+    }
+
+    if (headerReader.Read<uint64_t>() > byteLength)
+    {
+        throw GLTFException("The snapshot is truncated or corrupt");
+    }
+
+    if (headerReader.Read<uint32_t>() != SnapshotSectionCount)
+    {
+        throw GLTFException("The snapshot is truncated or corrupt");
+    }
+
+    Document document;
+
+    for (uint32_t i = 0U; i < SnapshotSectionCount; ++i)
+    {
+        SnapshotSectionEntry entry;
+        headerReader.ReadBytes(&entry, sizeof(entry));
+
+        if (entry.id != i || entry.offset > byteLength || entry.length > byteLength - entry.offset)
+        {
+            throw GLTFException("The snapshot is truncated or corrupt");
+        }
+
+        SnapshotReader reader(data + entry.offset, static_cast<size_t>(entry.length), extensionDeserializer);
+
+        SnapshotSections[i].read(reader, document);
+
+        if (!reader.IsEnd())
+        {
+            throw GLTFException("The snapshot is truncated or corrupt");
+        }
+    }
+
+    return document;
+}
+
+Document Microsoft::glTF::LoadSnapshot(std::istream& stream)
+{
+    return LoadSnapshot(stream, ExtensionDeserializer());
+}
+
+Document Microsoft::glTF::LoadSnapshot(std::istream& stream, const ExtensionDeserializer& extensionDeserializer)
+{
+    const auto position = stream.tellg();
+
+    if (auto memoryStream = dynamic_cast<const MemoryStream*>(&stream))
+    {
+        if (position < 0 || static_cast<size_t>(position) > memoryStream->Size())
+        {
+            throw GLTFException("Unable to read the snapshot from the stream");
+        }
+
+        const auto offset = static_cast<size_t>(position);
+
+        return LoadSnapshot(memoryStream->Data() + offset, memoryStream->Size() - offset, extensionDeserializer);
+    }
+
+    const std::vector<uint8_t> data((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+    return LoadSnapshot(data.data(), data.size(), extensionDeserializer);
+}
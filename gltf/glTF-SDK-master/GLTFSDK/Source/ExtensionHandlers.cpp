@@ -5,6 +5,7 @@
 
 #include <GLTFSDK/Exceptions.h>
 #include <GLTFSDK/GLTF.h>
+#include <GLTFSDK/RapidJsonUtils.h>
 
 using namespace Microsoft::glTF;
 
@@ -37,11 +38,64 @@ ExtensionPair ExtensionSerializer::Serialize(const Extension& extension, const g
 
 std::unique_ptr<Extension> ExtensionDeserializer::Deserialize(const ExtensionPair& extensionPair, const glTFProperty& property) const
 {
-    auto it = nameToType.find(Detail::MakeNameKey(extensionPair.name, property));
+    return Process(FindTypeKey(extensionPair.name, property), extensionPair.value, *this);
+}
+
+std::unique_ptr<Extension> ExtensionDeserializer::Deserialize(const std::string& name, const JsonValue& value, const glTFProperty& property) const
+{
+    const auto typeKey = FindTypeKey(name, property);
+
+    auto it = valueHandlers.find(typeKey);
+
+    if (it != valueHandlers.end())
+    {
+        return it->second(value, *this);
+    }
+
+    return Process(typeKey, Microsoft::glTF::Serialize(value.value), *this);
+}
+
+void ExtensionDeserializer::SetExtrasHandler(ExtrasFunc fn)
+{
+    extrasHandler = std::move(fn);
+}
+
+void ExtensionDeserializer::SetUnhandledExtensionHandler(UnhandledExtensionFunc fn)
+{
+    unhandledExtensionHandler = std::move(fn);
+}
+
+void ExtensionDeserializer::DeserializeExtras(const JsonValue& value, glTFProperty& property) const
+{
+    if (extrasHandler)
+    {
+        extrasHandler(value, property);
+    }
+    else
+    {
+        property.extras = Microsoft::glTF::Serialize(value.value);
+    }
+}
+
+void ExtensionDeserializer::DeserializeUnhandledExtension(const std::string& name, const JsonValue& value, glTFProperty& property) const
+{
+    if (unhandledExtensionHandler)
+    {
+        unhandledExtensionHandler(name, value, property);
+    }
+    else
+    {
+        property.extensions.emplace(name, Microsoft::glTF::Serialize(value.value));
+    }
+}
+
+Detail::TypeKey ExtensionDeserializer::FindTypeKey(const std::string& name, const glTFProperty& property) const
+{
+    auto it = nameToType.find(Detail::MakeNameKey(name, property));
 
     if (it == nameToType.end())
     {
-        it = nameToType.find(Detail::MakeNameKey<glTFPropertyAll>(extensionPair.name));
+        it = nameToType.find(Detail::MakeNameKey<glTFPropertyAll>(name));
     }
 
     if (it == nameToType.end())
@@ -49,5 +103,12 @@ std::unique_ptr<Extension> ExtensionDeserializer::Deserialize(const ExtensionPai
         throw GLTFException("No handler registered to deserialize the specified extension name");
     }
 
-    return Process({ it->second, it->first.second }, extensionPair.value, *this);
+    return { it->second, it->first.second };
+}
+
+std::unique_ptr<Extension> ExtensionDeserializer::DeserializeString(const std::string& json, const ExtensionDeserializer& extensionDeserializer, const ValueFunc& fn)
+{
+    const auto document = RapidJsonUtils::CreateDocumentFromString(json);
+
+    return fn(JsonValue{ document }, extensionDeserializer);
 }
@@ -18,35 +18,35 @@ namespace
             const rapidjson::Value& extensionsObject = extensionsIt->value;
             for (const auto& entry : extensionsObject.GetObject())
             {
-                ExtensionPair extensionPair = { entry.name.GetString(), Serialize(entry.value) };
+                const std::string name = entry.name.GetString();
 
-                if (extensionDeserializer.HasHandler(extensionPair.name, node) ||
-                    extensionDeserializer.HasHandler(extensionPair.name))
+                if (extensionDeserializer.HasHandler(name, node) ||
+                    extensionDeserializer.HasHandler(name))
                 {
-                    node.SetExtension(extensionDeserializer.Deserialize(extensionPair, node));
+                    // The handler is passed the parsed value - it is only serialized if the handler requires a string
+                    node.SetExtension(extensionDeserializer.Deserialize(name, JsonValue{ entry.value }, node));
                 }
                 else
                 {
-                    node.extensions.emplace(std::move(extensionPair.name), std::move(extensionPair.value));
+                    extensionDeserializer.DeserializeUnhandledExtension(name, JsonValue{ entry.value }, node);
                 }
             }
         }
     }
 
-    void ParseExtras(const rapidjson::Value& v, glTFProperty& node)
+    void ParseExtras(const rapidjson::Value& v, glTFProperty& node, const ExtensionDeserializer& extensionDeserializer)
     {
         rapidjson::Value::ConstMemberIterator it;
         if (TryFindMember("extras", v, it))
         {
-            const rapidjson::Value& a = it->value;
-            node.extras = Serialize(a);
+            extensionDeserializer.DeserializeExtras(JsonValue{ it->value }, node);
         }
     }
 
     void ParseProperty(const rapidjson::Value& v, glTFProperty& node, const ExtensionDeserializer& extensionDeserializer)
     {
         ParseExtensions(v, node, extensionDeserializer);
-        ParseExtras(v, node);
+        ParseExtras(v, node, extensionDeserializer);
     }
 
     void ParseTextureInfo(const rapidjson::Value& v, TextureInfo& textureInfo, const ExtensionDeserializer& extensionDeserializer)
@@ -57,6 +57,12 @@ namespace
         ParseProperty(v, textureInfo, extensionDeserializer);
     }
 
+    // Value handlers, passed the extension's parsed JSON value - see ExtensionDeserializer::AddValueHandler
+    std::unique_ptr<Extension> DeserializePBRSpecGlossValue(const JsonValue& json, const ExtensionDeserializer& extensionDeserializer);
+    std::unique_ptr<Extension> DeserializeUnlitValue(const JsonValue& json, const ExtensionDeserializer& extensionDeserializer);
+    std::unique_ptr<Extension> DeserializeDracoMeshCompressionValue(const JsonValue& json, const ExtensionDeserializer& extensionDeserializer);
+    std::unique_ptr<Extension> DeserializeTextureTransformValue(const JsonValue& json, const ExtensionDeserializer& extensionDeserializer);
+
     void SerializePropertyExtensions(const Document& gltfDocument, const glTFProperty& property, rapidjson::Value& propertyValue, rapidjson::Document::AllocatorType& a, const ExtensionSerializer& extensionSerializer)
     {
         auto registeredExtensions = property.GetExtensions();
@@ -148,12 +154,12 @@ ExtensionDeserializer KHR::GetKHRExtensionDeserializer()
     using namespace TextureInfos;
 
     ExtensionDeserializer extensionDeserializer;
-    extensionDeserializer.AddHandler<PBRSpecularGlossiness, Material>(PBRSPECULARGLOSSINESS_NAME, DeserializePBRSpecGloss);
-    extensionDeserializer.AddHandler<Unlit, Material>(UNLIT_NAME, DeserializeUnlit);
-    extensionDeserializer.AddHandler<DracoMeshCompression, MeshPrimitive>(DRACOMESHCOMPRESSION_NAME, DeserializeDracoMeshCompression);
-    extensionDeserializer.AddHandler<TextureTransform, TextureInfo>(TEXTURETRANSFORM_NAME, DeserializeTextureTransform);
-    extensionDeserializer.AddHandler<TextureTransform, Material::NormalTextureInfo>(TEXTURETRANSFORM_NAME, DeserializeTextureTransform);
-    extensionDeserializer.AddHandler<TextureTransform, Material::OcclusionTextureInfo>(TEXTURETRANSFORM_NAME, DeserializeTextureTransform);
+    extensionDeserializer.AddValueHandler<PBRSpecularGlossiness, Material>(PBRSPECULARGLOSSINESS_NAME, DeserializePBRSpecGlossValue);
+    extensionDeserializer.AddValueHandler<Unlit, Material>(UNLIT_NAME, DeserializeUnlitValue);
+    extensionDeserializer.AddValueHandler<DracoMeshCompression, MeshPrimitive>(DRACOMESHCOMPRESSION_NAME, DeserializeDracoMeshCompressionValue);
+    extensionDeserializer.AddValueHandler<TextureTransform, TextureInfo>(TEXTURETRANSFORM_NAME, DeserializeTextureTransformValue);
+    extensionDeserializer.AddValueHandler<TextureTransform, Material::NormalTextureInfo>(TEXTURETRANSFORM_NAME, DeserializeTextureTransformValue);
+    extensionDeserializer.AddValueHandler<TextureTransform, Material::OcclusionTextureInfo>(TEXTURETRANSFORM_NAME, DeserializeTextureTransformValue);
     return extensionDeserializer;
 }
 
@@ -229,57 +235,66 @@ std::string KHR::Materials::SerializePBRSpecGloss(const Materials::PBRSpecularGl
     return buffer.GetString();
 }
 
-std::unique_ptr<Extension> KHR::Materials::DeserializePBRSpecGloss(const std::string& json, const ExtensionDeserializer& extensionDeserializer)
+namespace
 {
-    Materials::PBRSpecularGlossiness specGloss;
+    std::unique_ptr<Extension> DeserializePBRSpecGlossValue(const JsonValue& json, const ExtensionDeserializer& extensionDeserializer)
+    {
+        KHR::Materials::PBRSpecularGlossiness specGloss;
 
-    auto doc = RapidJsonUtils::CreateDocumentFromString(json);
-    const auto sit = doc.GetObject();
+        const auto sit = json.value.GetObject();
 
-    // Diffuse Factor
-    auto diffuseFactIt = sit.FindMember("diffuseFactor");
-    if (diffuseFactIt != sit.MemberEnd())
-    {
-        std::vector<float> diffuseFactor;
-        for (rapidjson::Value::ConstValueIterator ait = diffuseFactIt->value.Begin(); ait != diffuseFactIt->value.End(); ++ait)
+        // Diffuse Factor
+        auto diffuseFactIt = sit.FindMember("diffuseFactor");
+        if (diffuseFactIt != sit.MemberEnd())
         {
-            diffuseFactor.push_back(static_cast<float>(ait->GetDouble()));
+            std::vector<float> diffuseFactor;
+            for (rapidjson::Value::ConstValueIterator ait = diffuseFactIt->value.Begin(); ait != diffuseFactIt->value.End(); ++ait)
+            {
+                diffuseFactor.push_back(static_cast<float>(ait->GetDouble()));
+            }
+            specGloss.diffuseFactor = Color4(diffuseFactor[0], diffuseFactor[1], diffuseFactor[2], diffuseFactor[3]);
         }
-        specGloss.diffuseFactor = Color4(diffuseFactor[0], diffuseFactor[1], diffuseFactor[2], diffuseFactor[3]);
-    }
 
-    // Diffuse Texture
-    const auto diffuseTextureIt = sit.FindMember("diffuseTexture");
-    if (diffuseTextureIt != sit.MemberEnd())
-    {
-        ParseTextureInfo(diffuseTextureIt->value, specGloss.diffuseTexture, extensionDeserializer);
-    }
+        // Diffuse Texture
+        const auto diffuseTextureIt = sit.FindMember("diffuseTexture");
+        if (diffuseTextureIt != sit.MemberEnd())
+        {
+            ParseTextureInfo(diffuseTextureIt->value, specGloss.diffuseTexture, extensionDeserializer);
+        }
 
-    // Specular Factor
-    auto specularFactIt = sit.FindMember("specularFactor");
-    if (specularFactIt != sit.MemberEnd())
-    {
-        std::vector<float> specularFactor;
-        for (rapidjson::Value::ConstValueIterator ait = specularFactIt->value.Begin(); ait != specularFactIt->value.End(); ++ait)
+        // Specular Factor
+        auto specularFactIt = sit.FindMember("specularFactor");
+        if (specularFactIt != sit.MemberEnd())
         {
-            specularFactor.push_back(static_cast<float>(ait->GetDouble()));
+            std::vector<float> specularFactor;
+            for (rapidjson::Value::ConstValueIterator ait = specularFactIt->value.Begin(); ait != specularFactIt->value.End(); ++ait)
+            {
+                specularFactor.push_back(static_cast<float>(ait->GetDouble()));
+            }
+            specGloss.specularFactor = Color3(specularFactor[0], specularFactor[1], specularFactor[2]);
         }
-        specGloss.specularFactor = Color3(specularFactor[0], specularFactor[1], specularFactor[2]);
-    }
 
-    // Glossiness Factor
-    specGloss.glossinessFactor = GetMemberValueOrDefault<float>(sit, "glossinessFactor", 1.0f);
+        // Glossiness Factor
+        specGloss.glossinessFactor = GetMemberValueOrDefault<float>(sit, "glossinessFactor", 1.0f);
 
-    // SpecularGlossinessTexture
-    const auto specularGlossinessTextureIt = sit.FindMember("specularGlossinessTexture");
-    if (specularGlossinessTextureIt != sit.MemberEnd())
-    {
-        ParseTextureInfo(specularGlossinessTextureIt->value, specGloss.specularGlossinessTexture, extensionDeserializer);
+        // SpecularGlossinessTexture
+        const auto specularGlossinessTextureIt = sit.FindMember("specularGlossinessTexture");
+        if (specularGlossinessTextureIt != sit.MemberEnd())
+        {
+            ParseTextureInfo(specularGlossinessTextureIt->value, specGloss.specularGlossinessTexture, extensionDeserializer);
+        }
+
+        ParseProperty(sit, specGloss, extensionDeserializer);
+
+        return std::make_unique<KHR::Materials::PBRSpecularGlossiness>(specGloss);
     }
+}
 
-    ParseProperty(sit, specGloss, extensionDeserializer);
+std::unique_ptr<Extension> KHR::Materials::DeserializePBRSpecGloss(const std::string& json, const ExtensionDeserializer& extensionDeserializer)
+{
+    const auto doc = RapidJsonUtils::CreateDocumentFromString(json);
 
-    return std::make_unique<PBRSpecularGlossiness>(specGloss);
+    return DeserializePBRSpecGlossValue(JsonValue{ doc }, extensionDeserializer);
 }
 
 // KHR::Materials::Unlit
@@ -309,16 +324,25 @@ std::string KHR::Materials::SerializeUnlit(const Materials::Unlit& extension, co
     return buffer.GetString();
 }
 
-std::unique_ptr<Extension> KHR::Materials::DeserializeUnlit(const std::string& json, const ExtensionDeserializer& extensionDeserializer)
+namespace
 {
-    Unlit unlit;
+    std::unique_ptr<Extension> DeserializeUnlitValue(const JsonValue& json, const ExtensionDeserializer& extensionDeserializer)
+    {
+        KHR::Materials::Unlit unlit;
+
+        const auto objValue = json.value.GetObject();
+
+        ParseProperty(objValue, unlit, extensionDeserializer);
 
-    auto doc = RapidJsonUtils::CreateDocumentFromString(json);
-    const auto objValue = doc.GetObject();
+        return std::make_unique<KHR::Materials::Unlit>(unlit);
+    }
+}
 
-    ParseProperty(objValue, unlit, extensionDeserializer);
+std::unique_ptr<Extension> KHR::Materials::DeserializeUnlit(const std::string& json, const ExtensionDeserializer& extensionDeserializer)
+{
+    const auto doc = RapidJsonUtils::CreateDocumentFromString(json);
 
-    return std::make_unique<Unlit>(unlit);
+    return DeserializeUnlitValue(JsonValue{ doc }, extensionDeserializer);
 }
 
 // KHR::MeshPrimitives::DracoMeshCompression
@@ -370,39 +394,48 @@ std::string KHR::MeshPrimitives::SerializeDracoMeshCompression(const MeshPrimiti
     return buffer.GetString();
 }
 
-std::unique_ptr<Extension> KHR::MeshPrimitives::DeserializeDracoMeshCompression(const std::string& json, const ExtensionDeserializer& extensionDeserializer)
+namespace
 {
-    auto extension = std::make_unique<DracoMeshCompression>();
-
-    auto doc = RapidJsonUtils::CreateDocumentFromString(json);
-    const auto v = doc.GetObject();
+    std::unique_ptr<Extension> DeserializeDracoMeshCompressionValue(const JsonValue& json, const ExtensionDeserializer& extensionDeserializer)
+    {
+        auto extension = std::make_unique<KHR::MeshPrimitives::DracoMeshCompression>();
 
-    extension->bufferViewId = GetMemberValueAsString<uint32_t>(v, "bufferView");
+        const auto v = json.value.GetObject();
 
-    rapidjson::Value::ConstMemberIterator it = v.FindMember("attributes");
-    if (it != v.MemberEnd())
-    {
-        if (!it->value.IsObject())
-        {
-            throw GLTFException("Member attributes of " + std::string(DRACOMESHCOMPRESSION_NAME) + " is not an object.");
-        }
-        const auto& attributes = it->value.GetObject();
+        extension->bufferViewId = GetMemberValueAsString<uint32_t>(v, "bufferView");
 
-        for (const auto& attribute : attributes)
+        rapidjson::Value::ConstMemberIterator it = v.FindMember("attributes");
+        if (it != v.MemberEnd())
         {
-            auto name = attribute.name.GetString();
+            if (!it->value.IsObject())
+            {
+                throw GLTFException("Member attributes of " + std::string(KHR::MeshPrimitives::DRACOMESHCOMPRESSION_NAME) + " is not an object.");
+            }
+            const auto& attributes = it->value.GetObject();
 
-            if (!attribute.value.IsInt())
+            for (const auto& attribute : attributes)
             {
-                throw GLTFException("Attribute " + std::string(name) + " of " + std::string(DRACOMESHCOMPRESSION_NAME) + " is not a number.");
+                auto name = attribute.name.GetString();
+
+                if (!attribute.value.IsInt())
+                {
+                    throw GLTFException("Attribute " + std::string(name) + " of " + std::string(KHR::MeshPrimitives::DRACOMESHCOMPRESSION_NAME) + " is not a number.");
+                }
+                extension->attributes.emplace(name, attribute.value.Get<uint32_t>());
             }
-            extension->attributes.emplace(name, attribute.value.Get<uint32_t>());
         }
+
+        ParseProperty(v, *extension, extensionDeserializer);
+
+        return extension;
     }
+}
 
-    ParseProperty(v, *extension, extensionDeserializer);
+std::unique_ptr<Extension> KHR::MeshPrimitives::DeserializeDracoMeshCompression(const std::string& json, const ExtensionDeserializer& extensionDeserializer)
+{
+    const auto doc = RapidJsonUtils::CreateDocumentFromString(json);
 
-    return extension;
+    return DeserializeDracoMeshCompressionValue(JsonValue{ doc }, extensionDeserializer);
 }
 
 // KHR::TextureInfos::TextureTransform
@@ -476,70 +509,79 @@ std::string KHR::TextureInfos::SerializeTextureTransform(const TextureTransform&
     return buffer.GetString();
 }
 
-std::unique_ptr<Extension> KHR::TextureInfos::DeserializeTextureTransform(const std::string& json, const ExtensionDeserializer& extensionDeserializer)
+namespace
 {
-    TextureTransform textureTransform;
+    std::unique_ptr<Extension> DeserializeTextureTransformValue(const JsonValue& json, const ExtensionDeserializer& extensionDeserializer)
+    {
+        KHR::TextureInfos::TextureTransform textureTransform;
 
-    auto doc = RapidJsonUtils::CreateDocumentFromString(json);
-    const auto sit = doc.GetObject();
+        const auto sit = json.value.GetObject();
 
-    // Offset
-    auto offsetIt = sit.FindMember("offset");
-    if (offsetIt != sit.MemberEnd())
-    {
-        if (!offsetIt->value.IsArray())
+        // Offset
+        auto offsetIt = sit.FindMember("offset");
+        if (offsetIt != sit.MemberEnd())
         {
-            throw GLTFException("Offset member of " + std::string(TEXTURETRANSFORM_NAME) + " must be an array.");
-        }
+            if (!offsetIt->value.IsArray())
+            {
+                throw GLTFException("Offset member of " + std::string(KHR::TextureInfos::TEXTURETRANSFORM_NAME) + " must be an array.");
+            }
 
-        if (offsetIt->value.Size() != 2)
-        {
-            throw GLTFException("Offset member of " + std::string(TEXTURETRANSFORM_NAME) + " must have two values.");
-        }
+            if (offsetIt->value.Size() != 2)
+            {
+                throw GLTFException("Offset member of " + std::string(KHR::TextureInfos::TEXTURETRANSFORM_NAME) + " must have two values.");
+            }
 
-        std::vector<float> offset;
-        for (rapidjson::Value::ConstValueIterator ait = offsetIt->value.Begin(); ait != offsetIt->value.End(); ++ait)
-        {
-            offset.push_back(static_cast<float>(ait->GetDouble()));
+            std::vector<float> offset;
+            for (rapidjson::Value::ConstValueIterator ait = offsetIt->value.Begin(); ait != offsetIt->value.End(); ++ait)
+            {
+                offset.push_back(static_cast<float>(ait->GetDouble()));
+            }
+            textureTransform.offset.x = offset[0];
+            textureTransform.offset.y = offset[1];
         }
-        textureTransform.offset.x = offset[0];
-        textureTransform.offset.y = offset[1];
-    }
 
-    // Rotation
-    textureTransform.rotation = GetMemberValueOrDefault<float>(sit, "rotation", 0.0f);
+        // Rotation
+        textureTransform.rotation = GetMemberValueOrDefault<float>(sit, "rotation", 0.0f);
 
-    // Scale
-    auto scaleIt = sit.FindMember("scale");
-    if (scaleIt != sit.MemberEnd())
-    {
-        if (!scaleIt->value.IsArray())
+        // Scale
+        auto scaleIt = sit.FindMember("scale");
+        if (scaleIt != sit.MemberEnd())
         {
-            throw GLTFException("Scale member of " + std::string(TEXTURETRANSFORM_NAME) + " must be an array.");
-        }
+            if (!scaleIt->value.IsArray())
+            {
+                throw GLTFException("Scale member of " + std::string(KHR::TextureInfos::TEXTURETRANSFORM_NAME) + " must be an array.");
+            }
 
-        if (scaleIt->value.Size() != 2)
-        {
-            throw GLTFException("Scale member of " + std::string(TEXTURETRANSFORM_NAME) + " must have two values.");
+            if (scaleIt->value.Size() != 2)
+            {
+                throw GLTFException("Scale member of " + std::string(KHR::TextureInfos::TEXTURETRANSFORM_NAME) + " must have two values.");
+            }
+
+            std::vector<float> scale;
+            for (rapidjson::Value::ConstValueIterator ait = scaleIt->value.Begin(); ait != scaleIt->value.End(); ++ait)
+            {
+                scale.push_back(static_cast<float>(ait->GetDouble()));
+            }
+            textureTransform.scale.x = scale[0];
+            textureTransform.scale.y = scale[1];
         }
 
-        std::vector<float> scale;
-        for (rapidjson::Value::ConstValueIterator ait = scaleIt->value.Begin(); ait != scaleIt->value.End(); ++ait)
+        // TexCoord
+        auto texCoordIt = sit.FindMember("texCoord");
+        if (texCoordIt != sit.MemberEnd())
         {
-            scale.push_back(static_cast<float>(ait->GetDouble()));
+            textureTransform.texCoord = static_cast<size_t>(texCoordIt->value.GetUint());
         }
-        textureTransform.scale.x = scale[0];
-        textureTransform.scale.y = scale[1];
-    }
 
-    // TexCoord
-    auto texCoordIt = sit.FindMember("texCoord");
-    if (texCoordIt != sit.MemberEnd())
-    {
-        textureTransform.texCoord = static_cast<size_t>(texCoordIt->value.GetUint());
+        ParseProperty(sit, textureTransform, extensionDeserializer);
+
+        return std::make_unique<KHR::TextureInfos::TextureTransform>(textureTransform);
     }
+}
 
-    ParseProperty(sit, textureTransform, extensionDeserializer);
+std::unique_ptr<Extension> KHR::TextureInfos::DeserializeTextureTransform(const std::string& json, const ExtensionDeserializer& extensionDeserializer)
+{
+    const auto doc = RapidJsonUtils::CreateDocumentFromString(json);
 
-    return std::make_unique<TextureTransform>(textureTransform);
+    return DeserializeTextureTransformValue(JsonValue{ doc }, extensionDeserializer);
 }
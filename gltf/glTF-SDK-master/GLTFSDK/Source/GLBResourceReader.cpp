@@ -87,11 +87,38 @@ std::streampos GLBResourceReader::GetBinaryStreamPos(const Buffer& buffer) const
     return streamPos;
 }
 
+bool GLBResourceReader::CanReadAt(const Buffer& buffer) const
+{
+    // The GLB buffer is read from the GLB stream, it has no uri to read from
+    if (buffer.uri.empty() || buffer.uri == EMPTY_URI)
+    {
+        return false;
+    }
+
+    return GLTFResourceReader::CanReadAt(buffer);
+}
+
 const std::string& GLBResourceReader::GetJson() const
 {
     return m_json;
 }
 
+Document GLBResourceReader::DeserializeJson(DeserializeFlags flags, SchemaFlags schemaFlags)
+{
+    std::string json;
+    json.swap(m_json);
+
+    return DeserializeInsitu(&json[0], flags, schemaFlags);
+}
+
+Document GLBResourceReader::DeserializeJson(const ExtensionDeserializer& extensions, DeserializeFlags flags, SchemaFlags schemaFlags)
+{
+    std::string json;
+    json.swap(m_json);
+
+    return DeserializeInsitu(&json[0], extensions, flags, schemaFlags);
+}
+
 void GLBResourceReader::Init()
 {
     // Get the length of the stream before reading anything, to validate against later
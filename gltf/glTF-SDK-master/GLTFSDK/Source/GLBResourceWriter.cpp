@@ -3,6 +3,9 @@
 
 #include <GLTFSDK/GLBResourceWriter.h>
 
+#include <GLTFSDK/Exceptions.h>
+
+#include <cstdio>
 #include <sstream>
 
 using namespace Microsoft::glTF;
@@ -20,6 +23,22 @@ namespace
     }
 }
 
+TemporaryFileStream::TemporaryFileStream(std::string path)
+    : std::fstream(path, std::ios::in | std::ios::out | std::ios::trunc | std::ios::binary),
+    m_path(std::move(path))
+{
+    if (!is_open())
+    {
+        throw GLTFException("Unable to create temporary file: " + m_path);
+    }
+}
+
+TemporaryFileStream::~TemporaryFileStream()
+{
+    close();
+    std::remove(m_path.c_str());
+}
+
 GLBResourceWriter::GLBResourceWriter(std::shared_ptr<const IStreamWriter> streamWriter)
     : GLBResourceWriter(std::move(streamWriter), std::make_unique<std::stringstream>())
 {
@@ -44,7 +63,25 @@ GLBResourceWriter::GLBResourceWriter(std::unique_ptr<IStreamWriterCache> streamC
 
 void GLBResourceWriter::Flush(const std::string& manifest, const std::string& uri)
 {
-    uint32_t jsonChunkLength = static_cast<uint32_t>(manifest.length());
+    WriteGLB(uri, manifest.length(), [&manifest](std::ostream& stream)
+    {
+        StreamUtils::WriteBinary(stream, manifest);
+    });
+}
+
+void GLBResourceWriter::Flush(const Document& document, const ExtensionSerializer& extensionSerializer, const std::string& uri, SerializeFlags flags)
+{
+    const size_t manifestLength = GetSerializedLength(document, extensionSerializer, flags);
+
+    WriteGLB(uri, manifestLength, [&](std::ostream& stream)
+    {
+        Serialize(document, stream, extensionSerializer, flags);
+    });
+}
+
+void GLBResourceWriter::WriteGLB(const std::string& uri, size_t manifestLength, const std::function<void(std::ostream&)>& writeManifest)
+{
+    uint32_t jsonChunkLength = static_cast<uint32_t>(manifestLength);
     const uint32_t jsonPaddingLength = ::CalculatePadding(jsonChunkLength);
 
     jsonChunkLength += jsonPaddingLength;
@@ -71,7 +108,7 @@ void GLBResourceWriter::Flush(const std::string& manifest, const std::string& ur
     StreamUtils::WriteBinary(*stream, GLB_CHUNK_TYPE_JSON, GLB_CHUNK_TYPE_SIZE);
 
     // Write JSON (indeterminate length)
-    StreamUtils::WriteBinary(*stream, manifest);
+    writeManifest(*stream);
 
     if (jsonPaddingLength > 0)
     {
@@ -86,6 +123,10 @@ void GLBResourceWriter::Flush(const std::string& manifest, const std::string& ur
     // Write BIN contents (indeterminate length) - copy the temporary buffer's contents to the output stream
     if (binaryChunkLength > 0)
     {
+        // A file stream shares a single position between reads and writes (unlike a stringstream) so it must be
+        // rewound before the contents can be read back
+        m_stream->seekg(0, std::ios::beg);
+
         *stream << m_stream->rdbuf();
     }
 
@@ -119,4 +160,4 @@ std::ostream* GLBResourceWriter::GetBufferStream(const std::string& bufferId)
     }
 
     return stream;
-}
\ No newline at end of file
+}
@@ -4,53 +4,603 @@
 #include <GLTFSDK/GLTFResourceReader.h>
 #include <GLTFSDK/ResourceReaderUtils.h>
 
+#include <algorithm>
+#include <limits>
+
 using namespace Microsoft::glTF;
 
 namespace
 {
     template<typename T>
-    std::vector<float> DecodeToFloats(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+    void DecodeToFloats(const std::vector<T>& rawData, bool normalized, float* floatData)
     {
-        std::vector<T> rawData = reader.ReadBinaryData<T>(doc, accessor);
-
-        std::vector<float> floatData;
-        floatData.reserve(rawData.size());
-
-        if (accessor.normalized)
+        if (normalized)
         {
-            for (size_t i = 0; i < rawData.size(); ++i)
-                floatData.push_back(ComponentToFloat(rawData[i]));
+            ComponentsToFloats(rawData.data(), rawData.size(), floatData);
         }
         else
         {
             for (size_t i = 0; i < rawData.size(); ++i)
-                floatData.push_back(static_cast<float>(rawData[i]));
+                floatData[i] = static_cast<float>(rawData[i]);
         }
+    }
 
+    template<typename T>
+    std::vector<float> DecodeToFloats(const std::vector<T>& rawData, bool normalized)
+    {
+        std::vector<float> floatData(rawData.size());
+        DecodeToFloats(rawData, normalized, floatData.data());
         return floatData;
     }
+
+    template<typename T>
+    std::vector<uint8_t> ReadAccessorBytes(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+    {
+        const size_t componentCount = accessor.count * Accessor::GetTypeCount(accessor.type);
+
+        std::vector<uint8_t> data(componentCount * sizeof(T));
+        reader.ReadBinaryData<T>(doc, accessor, reinterpret_cast<T*>(data.data()), componentCount);
+        return data;
+    }
+
+    std::vector<uint8_t> ReadAccessorBytes(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+    {
+        switch (accessor.componentType)
+        {
+        case COMPONENT_BYTE:
+            return ReadAccessorBytes<int8_t>(doc, reader, accessor);
+
+        case COMPONENT_UNSIGNED_BYTE:
+            return ReadAccessorBytes<uint8_t>(doc, reader, accessor);
+
+        case COMPONENT_SHORT:
+            return ReadAccessorBytes<int16_t>(doc, reader, accessor);
+
+        case COMPONENT_UNSIGNED_SHORT:
+            return ReadAccessorBytes<uint16_t>(doc, reader, accessor);
+
+        case COMPONENT_UNSIGNED_INT:
+            return ReadAccessorBytes<uint32_t>(doc, reader, accessor);
+
+        case COMPONENT_FLOAT:
+            return ReadAccessorBytes<float>(doc, reader, accessor);
+
+        default:
+            throw GLTFException("Unsupported accessor ComponentType");
+        }
+    }
 }
 
 std::vector<float> GLTFResourceReader::ReadFloatData(const Document& gltfDocument, const Accessor& accessor) const
 {
+    if (m_accessorCache)
+    {
+        return *ReadFloatDataShared(gltfDocument, accessor);
+    }
+
+    return DecodeFloatData(gltfDocument, accessor);
+}
+
+std::shared_ptr<const std::vector<float>> GLTFResourceReader::ReadFloatDataShared(const Document& gltfDocument, const Accessor& accessor) const
+{
+    if (m_accessorCache)
+    {
+        return m_accessorCache->Get<float>(accessor.id, [&]()
+        {
+            return DecodeFloatData(gltfDocument, accessor);
+        });
+    }
+
+    return std::make_shared<const std::vector<float>>(DecodeFloatData(gltfDocument, accessor));
+}
+
+size_t GLTFResourceReader::ReadFloatData(const Document& gltfDocument, const Accessor& accessor, float* data, size_t capacity) const
+{
+    if (accessor.componentType == COMPONENT_FLOAT)
+    {
+        return ReadBinaryData<float>(gltfDocument, accessor, data, capacity);
+    }
+
+    if (accessor.count * Accessor::GetTypeCount(accessor.type) > capacity)
+    {
+        throw GLTFException("The output buffer is too small for the data of accessor " + accessor.id);
+    }
+
+    if (auto cachedData = FindCachedData<float>(accessor))
+    {
+        std::copy(cachedData->begin(), cachedData->end(), data);
+        return cachedData->size();
+    }
+
     switch (accessor.componentType)
     {
     case COMPONENT_BYTE:
-        return DecodeToFloats<int8_t>(gltfDocument, *this, accessor);
+        DecodeToFloats(DecodeBinaryData<int8_t>(gltfDocument, accessor), accessor.normalized, data);
+        break;
 
     case COMPONENT_UNSIGNED_BYTE:
-        return DecodeToFloats<uint8_t>(gltfDocument, *this, accessor);
+        DecodeToFloats(DecodeBinaryData<uint8_t>(gltfDocument, accessor), accessor.normalized, data);
+        break;
 
     case COMPONENT_SHORT:
-        return DecodeToFloats<int16_t>(gltfDocument, *this, accessor);
+        DecodeToFloats(DecodeBinaryData<int16_t>(gltfDocument, accessor), accessor.normalized, data);
+        break;
 
     case COMPONENT_UNSIGNED_SHORT:
-        return DecodeToFloats<uint16_t>(gltfDocument, *this, accessor);
+        DecodeToFloats(DecodeBinaryData<uint16_t>(gltfDocument, accessor), accessor.normalized, data);
+        break;
+
+    default:
+        throw GLTFException("Unsupported accessor ComponentType");
+    }
+
+    return accessor.count * Accessor::GetTypeCount(accessor.type);
+}
+
+void GLTFResourceReader::SetDecodeDataUrisOnce(bool decodeDataUrisOnce)
+{
+    m_decodeDataUrisOnce = decodeDataUrisOnce;
+}
+
+bool GLTFResourceReader::GetDecodeDataUrisOnce() const
+{
+    return m_decodeDataUrisOnce;
+}
+
+void GLTFResourceReader::SetAccessorCache(std::shared_ptr<AccessorCache> accessorCache)
+{
+    m_accessorCache = std::move(accessorCache);
+}
+
+const std::shared_ptr<AccessorCache>& GLTFResourceReader::GetAccessorCache() const
+{
+    return m_accessorCache;
+}
+
+PrefetchHandle GLTFResourceReader::Prefetch(const Document& document, const ReadPlan& plan) const
+{
+    // Everything is read before anything is stored so that, if any read throws, nothing is left prefetched (there
+    // would be no handle with which to release it)
+    std::vector<std::pair<std::string, PrefetchedRange>> bufferRanges;
+
+    for (const auto& bufferRange : plan.GetBufferRanges())
+    {
+        const Buffer& buffer = document.buffers.Get(bufferRange.bufferId);
+
+        size_t bufferRangeEnd;
+
+        if (!Validation::SafeAddition(bufferRange.byteOffset, bufferRange.byteLength, bufferRangeEnd) || bufferRangeEnd > buffer.byteLength)
+        {
+            throw GLTFException("Prefetched range is outside the bounds of buffer " + buffer.id);
+        }
+
+        // Skip ranges that are already in memory (either prefetched previously or backed by a MemoryStream)
+        if (GetBinaryData(buffer, bufferRange.byteOffset, bufferRange.byteLength))
+        {
+            continue;
+        }
+
+        auto data = std::make_shared<const std::vector<uint8_t>>(ReadBinaryData<uint8_t>(buffer, bufferRange.byteOffset, bufferRange.byteLength));
+
+        bufferRanges.emplace_back(buffer.id, PrefetchedRange{ bufferRange.byteOffset, std::move(data) });
+    }
+
+    std::vector<std::pair<std::string, std::shared_ptr<const std::vector<uint8_t>>>> images;
+
+    for (const auto& imageUri : plan.GetImageUris())
+    {
+        {
+            std::lock_guard<std::mutex> lock(*m_mutex);
+
+            if (m_prefetchedImages.find(imageUri) != m_prefetchedImages.end())
+            {
+                continue;
+            }
+        }
+
+        images.emplace_back(imageUri, std::make_shared<const std::vector<uint8_t>>(ReadImageData(imageUri)));
+    }
+
+    PrefetchHandle handle;
+
+    std::lock_guard<std::mutex> lock(*m_mutex);
+
+    for (auto& bufferRange : bufferRanges)
+    {
+        auto& prefetchedRanges = m_prefetchedRanges[bufferRange.first];
+        auto& range = bufferRange.second;
+
+        // Another thread may have prefetched the range while it was being read
+        const bool isPrefetched = std::any_of(prefetchedRanges.begin(), prefetchedRanges.end(), [&range](const PrefetchedRange& prefetchedRange)
+        {
+            return range.byteOffset >= prefetchedRange.byteOffset
+                && range.byteOffset + range.data->size() <= prefetchedRange.byteOffset + prefetchedRange.data->size();
+        });
+
+        if (!isPrefetched)
+        {
+            handle.m_bufferRanges.emplace_back(bufferRange.first, range.data);
+            prefetchedRanges.push_back(std::move(range));
+        }
+    }
+
+    for (auto& image : images)
+    {
+        if (m_prefetchedImages.emplace(image.first, image.second).second)
+        {
+            handle.m_images.emplace_back(image.first, std::move(image.second));
+        }
+    }
+
+    return handle;
+}
+
+void GLTFResourceReader::ClearPrefetched() const
+{
+    std::lock_guard<std::mutex> lock(*m_mutex);
+    m_prefetchedRanges.clear();
+    m_prefetchedImages.clear();
+}
+
+void GLTFResourceReader::ClearPrefetched(const ReadPlan& plan) const
+{
+    std::lock_guard<std::mutex> lock(*m_mutex);
+
+    for (const auto& bufferRange : plan.GetBufferRanges())
+    {
+        auto it = m_prefetchedRanges.find(bufferRange.bufferId);
+
+        if (it == m_prefetchedRanges.end())
+        {
+            continue;
+        }
+
+        auto& prefetchedRanges = it->second;
+
+        prefetchedRanges.erase(std::remove_if(prefetchedRanges.begin(), prefetchedRanges.end(), [&bufferRange](const PrefetchedRange& prefetchedRange)
+        {
+            return prefetchedRange.byteOffset >= bufferRange.byteOffset
+                && prefetchedRange.byteOffset + prefetchedRange.data->size() <= bufferRange.byteOffset + bufferRange.byteLength;
+        }), prefetchedRanges.end());
+
+        if (prefetchedRanges.empty())
+        {
+            m_prefetchedRanges.erase(it);
+        }
+    }
+
+    for (const auto& imageUri : plan.GetImageUris())
+    {
+        m_prefetchedImages.erase(imageUri);
+    }
+}
+
+void GLTFResourceReader::ClearPrefetched(const PrefetchHandle& handle) const
+{
+    std::lock_guard<std::mutex> lock(*m_mutex);
+
+    for (const auto& bufferRange : handle.m_bufferRanges)
+    {
+        auto data = bufferRange.second.lock();
+        auto it = m_prefetchedRanges.find(bufferRange.first);
+
+        if (!data || it == m_prefetchedRanges.end())
+        {
+            continue;
+        }
+
+        auto& prefetchedRanges = it->second;
+
+        prefetchedRanges.erase(std::remove_if(prefetchedRanges.begin(), prefetchedRanges.end(), [&data](const PrefetchedRange& prefetchedRange)
+        {
+            return prefetchedRange.data == data;
+        }), prefetchedRanges.end());
+
+        if (prefetchedRanges.empty())
+        {
+            m_prefetchedRanges.erase(it);
+        }
+    }
+
+    for (const auto& image : handle.m_images)
+    {
+        auto data = image.second.lock();
+        auto it = m_prefetchedImages.find(image.first);
+
+        if (data && it != m_prefetchedImages.end() && it->second == data)
+        {
+            m_prefetchedImages.erase(it);
+        }
+    }
+}
+
+void GLTFResourceReader::SetBufferRangeCache(std::shared_ptr<BufferRangeCache> bufferRangeCache)
+{
+    m_bufferRangeCache = std::move(bufferRangeCache);
+}
+
+const std::shared_ptr<BufferRangeCache>& GLTFResourceReader::GetBufferRangeCache() const
+{
+    return m_bufferRangeCache;
+}
+
+std::vector<std::vector<uint8_t>> GLTFResourceReader::ReadAccessorsParallel(const Document& document, IExecutor& executor) const
+{
+    std::vector<std::string> accessorIds;
+    accessorIds.reserve(document.accessors.Size());
+
+    for (const auto& accessor : document.accessors.Elements())
+    {
+        accessorIds.push_back(accessor.id);
+    }
+
+    return ReadAccessorsParallel(document, accessorIds, executor);
+}
+
+std::vector<std::vector<uint8_t>> GLTFResourceReader::ReadAccessorsParallel(const Document& document, const std::vector<std::string>& accessorIds, IExecutor& executor) const
+{
+    // Resolve every accessor before submitting any task so that an unknown id throws without leaving tasks running
+    std::vector<const Accessor*> accessors;
+    accessors.reserve(accessorIds.size());
+
+    for (const auto& accessorId : accessorIds)
+    {
+        accessors.push_back(&document.accessors.Get(accessorId));
+    }
+
+    // The tasks reference the document and this reader so, even if submitting a task throws, those already
+    // submitted must complete before returning
+    FutureWaiter<std::vector<uint8_t>> waiter(executor);
+    auto& futures = waiter.GetFutures();
+    futures.reserve(accessors.size());
+
+    for (const auto accessor : accessors)
+    {
+        futures.push_back(Submit(executor, [&document, accessor, this]()
+        {
+            return ReadAccessorBytes(document, *this, *accessor);
+        }));
+    }
+
+    waiter.Wait();
+
+    std::vector<std::vector<uint8_t>> result;
+    result.reserve(futures.size());
+
+    // Every task has completed so the first exception, in the order of accessorIds, is rethrown
+    for (auto& future : futures)
+    {
+        result.push_back(future.get());
+    }
+
+    return result;
+}
+
+void GLTFResourceReader::SetExecutor(std::shared_ptr<IExecutor> executor)
+{
+    m_executor = std::move(executor);
+}
+
+const std::shared_ptr<IExecutor>& GLTFResourceReader::GetExecutor() const
+{
+    return m_executor;
+}
+
+void GLTFResourceReader::SetRandomAccessReader(std::shared_ptr<const IRandomAccessReader> randomAccessReader)
+{
+    m_randomAccessReader = std::move(randomAccessReader);
+}
+
+const std::shared_ptr<const IRandomAccessReader>& GLTFResourceReader::GetRandomAccessReader() const
+{
+    return m_randomAccessReader;
+}
+
+std::future<std::vector<uint8_t>> GLTFResourceReader::ReadBinaryDataAsync(const Document& document, const Image& image) const
+{
+    return Submit(GetAsyncExecutor(), [this, &document, image]()
+    {
+        return ReadBinaryData(document, image);
+    });
+}
+
+std::future<std::vector<float>> GLTFResourceReader::ReadFloatDataAsync(const Document& gltfDocument, const Accessor& accessor) const
+{
+    return Submit(GetAsyncExecutor(), [this, &gltfDocument, accessor]()
+    {
+        return ReadFloatData(gltfDocument, accessor);
+    });
+}
+
+std::future<PrefetchHandle> GLTFResourceReader::PrefetchAsync(const Document& document, const ReadPlan& plan) const
+{
+    return Submit(GetAsyncExecutor(), [this, &document, plan]()
+    {
+        return Prefetch(document, plan);
+    });
+}
+
+std::shared_ptr<const uint8_t> GLTFResourceReader::GetPrefetchedData(const Buffer& buffer, size_t offset, size_t byteLength) const
+{
+    std::lock_guard<std::mutex> lock(*m_mutex);
+
+    auto it = m_prefetchedRanges.find(buffer.id);
+
+    if (it != m_prefetchedRanges.end())
+    {
+        for (const auto& prefetchedRange : it->second)
+        {
+            if (offset >= prefetchedRange.byteOffset &&
+                byteLength <= prefetchedRange.data->size() &&
+                offset - prefetchedRange.byteOffset <= prefetchedRange.data->size() - byteLength)
+            {
+                return std::shared_ptr<const uint8_t>(prefetchedRange.data, prefetchedRange.data->data() + (offset - prefetchedRange.byteOffset));
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+std::shared_ptr<const uint8_t> GLTFResourceReader::GetDataUriData(const Buffer& buffer, size_t offset, size_t byteLength) const
+{
+    std::string::const_iterator itBegin;
+    std::string::const_iterator itEnd;
+
+    if (!IsUriBase64(buffer.uri, itBegin, itEnd))
+    {
+        return nullptr;
+    }
+
+    // Decoding isn't performed while holding the lock. If multiple threads decode the same data uri
+    // concurrently then the first data to be inserted is retained and returned to all.
+    auto data = std::make_shared<const std::vector<uint8_t>>(Base64Decode(Base64StringView(itBegin, itEnd)));
+
+    size_t dataEnd;
+
+    if (!Validation::SafeAddition(offset, byteLength, dataEnd) || dataEnd > data->size())
+    {
+        throw GLTFException("Buffer data range is outside the bounds of the data uri of buffer " + buffer.id);
+    }
+
+    std::lock_guard<std::mutex> lock(*m_mutex);
+
+    auto& prefetchedRanges = m_prefetchedRanges[buffer.id];
+
+    auto it = std::find_if(prefetchedRanges.begin(), prefetchedRanges.end(), [&data](const PrefetchedRange& prefetchedRange)
+    {
+        return prefetchedRange.byteOffset == 0U && prefetchedRange.data->size() == data->size();
+    });
+
+    if (it == prefetchedRanges.end())
+    {
+        prefetchedRanges.push_back({ 0U, data });
+    }
+    else
+    {
+        data = it->data;
+    }
+
+    return std::shared_ptr<const uint8_t>(data, data->data() + offset);
+}
+
+IExecutor& GLTFResourceReader::GetAsyncExecutor() const
+{
+    if (m_executor)
+    {
+        return *m_executor;
+    }
+
+    static ThreadPool threadPool;
+    return threadPool;
+}
+
+std::vector<float> GLTFResourceReader::DecodeFloatData(const Document& gltfDocument, const Accessor& accessor) const
+{
+    switch (accessor.componentType)
+    {
+    case COMPONENT_BYTE:
+        return DecodeToFloats(DecodeBinaryData<int8_t>(gltfDocument, accessor), accessor.normalized);
+
+    case COMPONENT_UNSIGNED_BYTE:
+        return DecodeToFloats(DecodeBinaryData<uint8_t>(gltfDocument, accessor), accessor.normalized);
+
+    case COMPONENT_SHORT:
+        return DecodeToFloats(DecodeBinaryData<int16_t>(gltfDocument, accessor), accessor.normalized);
+
+    case COMPONENT_UNSIGNED_SHORT:
+        return DecodeToFloats(DecodeBinaryData<uint16_t>(gltfDocument, accessor), accessor.normalized);
 
     case COMPONENT_FLOAT:
-        return ReadBinaryData<float>(gltfDocument, accessor);
+        return DecodeBinaryData<float>(gltfDocument, accessor);
 
     default:
         throw GLTFException("Unsupported accessor ComponentType");
     }
 }
+
+std::shared_ptr<const std::vector<uint8_t>> GLTFResourceReader::GetCachedBufferViewData(const Buffer& buffer, const BufferView& bufferView) const
+{
+    if (!m_bufferRangeCache || bufferView.byteLength == 0U || bufferView.byteLength > m_bufferRangeCache->GetByteBudget())
+    {
+        return nullptr;
+    }
+
+    // Data that is already in memory gains nothing from being copied into the cache
+    if (GetBinaryData(buffer, bufferView.byteOffset, bufferView.byteLength))
+    {
+        return nullptr;
+    }
+
+    const BufferRange bufferRange = { buffer.id, bufferView.byteOffset, bufferView.byteLength };
+
+    auto data = m_bufferRangeCache->Get(m_bufferRangeCacheSourceId, bufferRange);
+
+    if (!data)
+    {
+        data = std::make_shared<const std::vector<uint8_t>>(ReadBinaryData<uint8_t>(buffer, bufferView.byteOffset, bufferView.byteLength));
+        m_bufferRangeCache->Insert(m_bufferRangeCacheSourceId, bufferRange, data);
+    }
+
+    return data;
+}
+
+std::vector<uint8_t> GLTFResourceReader::ReadImageData(const std::string& uri) const
+{
+    if (m_randomAccessReader)
+    {
+        const uint64_t size = m_randomAccessReader->GetSize(uri);
+
+        if (size > std::numeric_limits<size_t>::max())
+        {
+            throw GLTFException("Image " + uri + " is too large to read");
+        }
+
+        std::vector<uint8_t> data(static_cast<size_t>(size));
+        m_randomAccessReader->ReadAt(uri, 0U, data.size(), data.data());
+        return data;
+    }
+
+    std::unique_lock<std::mutex> lock(*m_mutex);
+
+    auto stream = m_streamReaderCache->Get(uri);
+
+    if (!stream)
+    {
+        throw GLTFException("Unable to read image data");
+    }
+
+    // A MemoryStream's data is immutable (and kept alive by the stream) so is copied without holding the lock
+    if (auto memoryStream = std::dynamic_pointer_cast<const MemoryStream>(stream))
+    {
+        lock.unlock();
+
+        return std::vector<uint8_t>(memoryStream->Data(), memoryStream->Data() + memoryStream->Size());
+    }
+
+    return StreamUtils::ReadBinaryFull<uint8_t>(*stream);
+}
+
+void GLTFResourceReader::ReadBinaryStream(const Buffer& buffer, std::streamoff offset, void* data, size_t byteLength) const
+{
+    if (CanReadAt(buffer))
+    {
+        if (offset < 0)
+        {
+            throw GLTFException("Negative offsets are not supported");
+        }
+
+        m_randomAccessReader->ReadAt(buffer.uri, static_cast<uint64_t>(offset), byteLength, data);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(*m_mutex);
+
+    auto bufferStream = GetBinaryStream(buffer);
+    auto bufferStreamPos = GetBinaryStreamPos(buffer);
+
+    bufferStream->seekg(bufferStreamPos);
+    bufferStream->seekg(offset, std::ios_base::cur);
+
+    StreamUtils::ReadBinary(*bufferStream, static_cast<char*>(data), byteLength);
+}
@@ -0,0 +1,119 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/JsonArena.h>
+
+#include <algorithm>
+
+using namespace Microsoft::glTF;
+
+constexpr size_t JsonArena::DefaultCapacity;
+constexpr size_t JsonArena::StackCapacity;
+constexpr size_t JsonArena::MinimumCapacity;
+
+const bool JsonArena::CountingAllocator::kNeedFree;
+
+JsonArena::CountingAllocator::CountingAllocator(size_t* allocationCount) : m_allocationCount(allocationCount)
+{
+}
+
+void* JsonArena::CountingAllocator::Malloc(size_t size)
+{
+    if (size && m_allocationCount)
+    {
+        ++*m_allocationCount;
+    }
+
+    return m_allocator.Malloc(size);
+}
+
+void* JsonArena::CountingAllocator::Realloc(void* originalPtr, size_t originalSize, size_t newSize)
+{
+    if (newSize && m_allocationCount)
+    {
+        ++*m_allocationCount;
+    }
+
+    return m_allocator.Realloc(originalPtr, originalSize, newSize);
+}
+
+void JsonArena::CountingAllocator::Free(void* ptr)
+{
+    rapidjson::CrtAllocator::Free(ptr);
+}
+
+JsonArena::JsonArena(size_t capacity) :
+    m_allocationCount(0U),
+    m_baseAllocator(&m_allocationCount),
+    m_capacity(0U),
+    m_poolCapacity(0U),
+    m_stringBuffer(&m_baseAllocator)
+{
+    Allocate(std::max(capacity, MinimumCapacity));
+}
+
+void JsonArena::Reset()
+{
+    // The chunks are freed below so are counted now
+    const size_t chunkCount = GetChunkCount();
+
+    m_allocationCount += chunkCount;
+
+    if (chunkCount > 0U)
+    {
+        const size_t size = m_allocator->Size();
+
+        Allocate(std::max(m_capacity * 2U, size + size / 4U));
+    }
+    else
+    {
+        m_allocator->Clear();
+    }
+}
+
+rapidjson::MemoryPoolAllocator<>& JsonArena::GetAllocator()
+{
+    return *m_allocator;
+}
+
+JsonArena::CountingAllocator& JsonArena::GetStackAllocator()
+{
+    return m_baseAllocator;
+}
+
+JsonArena::StringBuffer& JsonArena::GetStringBuffer()
+{
+    return m_stringBuffer;
+}
+
+size_t JsonArena::GetCapacity() const
+{
+    return m_capacity;
+}
+
+size_t JsonArena::GetAllocationCount() const
+{
+    return m_allocationCount + GetChunkCount();
+}
+
+void JsonArena::Allocate(size_t capacity)
+{
+    // The allocator references the buffer so must be destroyed (freeing any additional chunks) first
+    m_allocator.reset();
+
+    m_buffer.reset(new char[capacity]);
+    m_capacity = capacity;
+
+    ++m_allocationCount;
+
+    m_allocator = std::make_unique<rapidjson::MemoryPoolAllocator<>>(m_buffer.get(), m_capacity, DefaultCapacity, &m_chunkAllocator);
+    m_poolCapacity = m_allocator->Capacity();
+}
+
+size_t JsonArena::GetChunkCount() const
+{
+    // The pool's capacity only grows once the buffer is exhausted and additional chunks have been allocated
+    const size_t growth = m_allocator->Capacity() - m_poolCapacity;
+
+    return (growth + DefaultCapacity - 1U) / DefaultCapacity;
+}
@@ -0,0 +1,164 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/MemoryMappedStreamReader.h>
+
+#include <GLTFSDK/Exceptions.h>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace Microsoft::glTF;
+
+#ifdef _WIN32
+
+MemoryMappedFile::MemoryMappedFile(const std::string& path) :
+    m_data(nullptr),
+    m_size(0U),
+    m_file(INVALID_HANDLE_VALUE),
+    m_mapping(nullptr)
+{
+    m_file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (m_file == INVALID_HANDLE_VALUE)
+    {
+        throw GLTFException("Unable to open file for memory mapping: " + path);
+    }
+
+    LARGE_INTEGER fileSize;
+
+    if (!GetFileSizeEx(m_file, &fileSize))
+    {
+        CloseHandle(m_file);
+        throw GLTFException("Unable to query the size of file: " + path);
+    }
+
+    m_size = static_cast<size_t>(fileSize.QuadPart);
+
+    // Zero length files can't be mapped - leave m_data as nullptr
+    if (m_size > 0U)
+    {
+        m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+        if (m_mapping == nullptr)
+        {
+            CloseHandle(m_file);
+            throw GLTFException("Unable to create a file mapping for file: " + path);
+        }
+
+        m_data = static_cast<const uint8_t*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+
+        if (m_data == nullptr)
+        {
+            CloseHandle(m_mapping);
+            CloseHandle(m_file);
+            throw GLTFException("Unable to map a view of file: " + path);
+        }
+    }
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    if (m_data)
+    {
+        UnmapViewOfFile(m_data);
+    }
+
+    if (m_mapping)
+    {
+        CloseHandle(m_mapping);
+    }
+
+    CloseHandle(m_file);
+}
+
+#else
+
+MemoryMappedFile::MemoryMappedFile(const std::string& path) :
+    m_data(nullptr),
+    m_size(0U)
+{
+    const int fd = open(path.c_str(), O_RDONLY);
+
+    if (fd == -1)
+    {
+        throw GLTFException("Unable to open file for memory mapping: " + path);
+    }
+
+    struct stat fileStat;
+
+    if (fstat(fd, &fileStat) != 0)
+    {
+        close(fd);
+        throw GLTFException("Unable to query the size of file: " + path);
+    }
+
+    m_size = static_cast<size_t>(fileStat.st_size);
+
+    // Zero length files can't be mapped - leave m_data as nullptr
+    if (m_size > 0U)
+    {
+        void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (data == MAP_FAILED)
+        {
+            close(fd);
+            throw GLTFException("Unable to map file: " + path);
+        }
+
+        m_data = static_cast<const uint8_t*>(data);
+    }
+
+    // The mapping remains valid after the file descriptor is closed
+    close(fd);
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    if (m_data)
+    {
+        munmap(const_cast<uint8_t*>(m_data), m_size);
+    }
+}
+
+#endif
+
+const uint8_t* MemoryMappedFile::Data() const
+{
+    return m_data;
+}
+
+size_t MemoryMappedFile::Size() const
+{
+    return m_size;
+}
+
+MemoryMappedStreamReader::MemoryMappedStreamReader(std::string pathBase) : m_pathBase(std::move(pathBase))
+{
+    if (!m_pathBase.empty() && m_pathBase.back() != '/' && m_pathBase.back() != '\\')
+    {
+        m_pathBase += '/';
+    }
+}
+
+std::shared_ptr<std::istream> MemoryMappedStreamReader::GetInputStream(const std::string& uri) const
+{
+    auto file = std::make_shared<const MemoryMappedFile>(m_pathBase + uri);
+
+    const auto data = file->Data();
+    const auto size = file->Size();
+
+    return std::make_shared<MemoryStream>(std::move(file), data, size);
+}
@@ -6,6 +6,7 @@
 #include <GLTFSDK/GLTF.h>
 #include <GLTFSDK/GLTFResourceReader.h>
 #include <GLTFSDK/BufferBuilder.h>
+#include <GLTFSDK/ReadPlan.h>
 
 #include <cassert>
 #include <numeric>
@@ -41,6 +42,104 @@ namespace
             static_cast<uint32_t>(byte0);
     }
 
+    void ValidateIndicesAccessor(const Accessor& accessor)
+    {
+        if (accessor.type != TYPE_SCALAR)
+        {
+            throw GLTFException("Invalid type for indices accessor " + accessor.id);
+        }
+    }
+
+    void ValidatePositionsAccessor(const Accessor& positionsAccessor)
+    {
+        if (positionsAccessor.type != TYPE_VEC3)
+        {
+            throw GLTFException("Invalid type for positions accessor " + positionsAccessor.id);
+        }
+
+        if (positionsAccessor.componentType != COMPONENT_FLOAT)
+        {
+            throw GLTFException("Invalid component type for positions accessor " + positionsAccessor.id);
+        }
+    }
+
+    void ValidateNormalsAccessor(const Accessor& normalsAccessor)
+    {
+        if (normalsAccessor.type != TYPE_VEC3)
+        {
+            throw GLTFException("Invalid type for normals accessor " + normalsAccessor.id);
+        }
+
+        if (normalsAccessor.componentType != COMPONENT_FLOAT)
+        {
+            throw GLTFException("Invalid component type for normals accessor " + normalsAccessor.id);
+        }
+    }
+
+    void ValidateTangentsAccessor(const Accessor& tangentsAccessor, AccessorType tangentsType)
+    {
+        if (tangentsAccessor.type != tangentsType)
+        {
+            throw GLTFException("Invalid type for tangents accessor " + tangentsAccessor.id);
+        }
+
+        if (tangentsAccessor.componentType != COMPONENT_FLOAT)
+        {
+            throw GLTFException("Invalid component type for tangents accessor " + tangentsAccessor.id);
+        }
+    }
+
+    void ValidateTexCoordsAccessor(const Accessor& accessor)
+    {
+        if (accessor.type != TYPE_VEC2)
+        {
+            throw GLTFException("Invalid type for texcoords accessor " + accessor.id);
+        }
+
+        if (accessor.componentType != COMPONENT_FLOAT && accessor.componentType != COMPONENT_UNSIGNED_BYTE && accessor.componentType != COMPONENT_UNSIGNED_SHORT)
+        {
+            throw GLTFException("Invalid component type for texcoords accessor " + accessor.id);
+        }
+    }
+
+    // Reads indices of type TIn, widening them to TOut, into a caller provided buffer
+    template<typename TIn, typename TOut>
+    size_t ReadIndices(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, TOut* data, size_t capacity)
+    {
+        static_assert(sizeof(TOut) > sizeof(TIn), "sizeof(TOut) > sizeof(TIn)");
+
+        if (accessor.count > capacity)
+        {
+            throw GLTFException("The output buffer is too small for the data of accessor " + accessor.id);
+        }
+
+        const auto indices = reader.ReadBinaryData<TIn>(doc, accessor);
+        std::copy(indices.begin(), indices.end(), data);
+        return indices.size();
+    }
+
+    // Prefetches a ReadPlan's buffer ranges and releases their memory on destruction. Only the ranges this prefetch
+    // stored are released, any the caller had already prefetched are left in place.
+    class ScopedPrefetch
+    {
+    public:
+        ScopedPrefetch(const Document& doc, const GLTFResourceReader& reader, const ReadPlan& plan) : m_reader(reader), m_handle(m_reader.Prefetch(doc, plan))
+        {
+        }
+
+        ~ScopedPrefetch()
+        {
+            m_reader.ClearPrefetched(m_handle);
+        }
+
+        ScopedPrefetch(const ScopedPrefetch&) = delete;
+        ScopedPrefetch& operator=(const ScopedPrefetch&) = delete;
+
+    private:
+        const GLTFResourceReader& m_reader;
+        const PrefetchHandle m_handle;
+    };
+
     template<typename TIn, typename TOut>
     std::vector<TOut> ReadIndices(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
     {
@@ -512,13 +611,82 @@ namespace
     }
 }
 
-std::vector<uint16_t> MeshPrimitiveUtils::GetIndices16(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+MeshPrimitiveUtils::MeshPrimitiveData MeshPrimitiveUtils::ReadPrimitive(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
 {
-    if (accessor.type != TYPE_SCALAR)
+    // Only the accessors read below are prefetched (i.e. not any other attributes or the morph targets)
+    ReadPlan plan;
+
+    if (!meshPrimitive.indicesAccessorId.empty())
+    {
+        plan.AddAccessor(doc, doc.accessors.Get(meshPrimitive.indicesAccessorId));
+    }
+
+    for (const char* attributeName : { ACCESSOR_POSITION, ACCESSOR_NORMAL, ACCESSOR_TANGENT, ACCESSOR_TEXCOORD_0, ACCESSOR_TEXCOORD_1, ACCESSOR_COLOR_0, ACCESSOR_JOINTS_0, ACCESSOR_WEIGHTS_0 })
+    {
+        std::string accessorId;
+
+        if (meshPrimitive.TryGetAttributeAccessorId(attributeName, accessorId))
+        {
+            plan.AddAccessor(doc, doc.accessors.Get(accessorId));
+        }
+    }
+
+    ScopedPrefetch prefetch(doc, reader, plan);
+
+    MeshPrimitiveData data;
+
+    if (!meshPrimitive.indicesAccessorId.empty())
     {
-        throw GLTFException("Invalid type for indices accessor " + accessor.id);
+        data.indices = GetIndices32(doc, reader, meshPrimitive);
     }
 
+    if (meshPrimitive.HasAttribute(ACCESSOR_POSITION))
+    {
+        data.positions = GetPositions(doc, reader, meshPrimitive);
+    }
+
+    if (meshPrimitive.HasAttribute(ACCESSOR_NORMAL))
+    {
+        data.normals = GetNormals(doc, reader, meshPrimitive);
+    }
+
+    if (meshPrimitive.HasAttribute(ACCESSOR_TANGENT))
+    {
+        data.tangents = GetTangents(doc, reader, meshPrimitive);
+    }
+
+    if (meshPrimitive.HasAttribute(ACCESSOR_TEXCOORD_0))
+    {
+        data.texCoords0 = GetTexCoords_0(doc, reader, meshPrimitive);
+    }
+
+    if (meshPrimitive.HasAttribute(ACCESSOR_TEXCOORD_1))
+    {
+        data.texCoords1 = GetTexCoords_1(doc, reader, meshPrimitive);
+    }
+
+    if (meshPrimitive.HasAttribute(ACCESSOR_COLOR_0))
+    {
+        data.colors0 = GetColors_0(doc, reader, meshPrimitive);
+    }
+
+    if (meshPrimitive.HasAttribute(ACCESSOR_JOINTS_0))
+    {
+        data.jointIndices0 = GetJointIndices64_0(doc, reader, meshPrimitive);
+    }
+
+    if (meshPrimitive.HasAttribute(ACCESSOR_WEIGHTS_0))
+    {
+        data.jointWeights0 = GetJointWeights32_0(doc, reader, meshPrimitive);
+    }
+
+    return data;
+}
+
+std::vector<uint16_t> MeshPrimitiveUtils::GetIndices16(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+{
+    ValidateIndicesAccessor(accessor);
+
     switch (accessor.componentType)
     {
     case COMPONENT_UNSIGNED_BYTE:
@@ -541,12 +709,35 @@ std::vector<uint16_t> MeshPrimitiveUtils::GetIndices16(const Document& doc, cons
     return GetIndices16(doc, reader, accessor);
 }
 
-std::vector<uint32_t> MeshPrimitiveUtils::GetIndices32(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+size_t MeshPrimitiveUtils::GetIndices16(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, uint16_t* data, size_t capacity)
 {
-    if (accessor.type != TYPE_SCALAR)
+    ValidateIndicesAccessor(accessor);
+
+    switch (accessor.componentType)
     {
-        throw GLTFException("Invalid type for indices accessor " + accessor.id);
+    case COMPONENT_UNSIGNED_BYTE:
+        return ReadIndices<uint8_t, uint16_t>(doc, reader, accessor, data, capacity);
+
+    case COMPONENT_UNSIGNED_SHORT:
+        return reader.ReadBinaryData<uint16_t>(doc, accessor, data, capacity);
+
+    case COMPONENT_UNSIGNED_INT:
+        throw GLTFException("Cannot convert 32-bit indices to 16-bit");
+
+    default:
+        throw GLTFException("Invalid componentType for indices accessor " + accessor.id);
     }
+}
+
+size_t MeshPrimitiveUtils::GetIndices16(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, uint16_t* data, size_t capacity)
+{
+    const auto& accessor = doc.accessors.Get(meshPrimitive.indicesAccessorId);
+    return GetIndices16(doc, reader, accessor, data, capacity);
+}
+
+std::vector<uint32_t> MeshPrimitiveUtils::GetIndices32(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+{
+    ValidateIndicesAccessor(accessor);
 
     switch (accessor.componentType)
     {
@@ -570,6 +761,32 @@ std::vector<uint32_t> MeshPrimitiveUtils::GetIndices32(const Document& doc, cons
     return GetIndices32(doc, reader, accessor);
 }
 
+size_t MeshPrimitiveUtils::GetIndices32(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, uint32_t* data, size_t capacity)
+{
+    ValidateIndicesAccessor(accessor);
+
+    switch (accessor.componentType)
+    {
+    case COMPONENT_UNSIGNED_BYTE:
+        return ReadIndices<uint8_t, uint32_t>(doc, reader, accessor, data, capacity);
+
+    case COMPONENT_UNSIGNED_SHORT:
+        return ReadIndices<uint16_t, uint32_t>(doc, reader, accessor, data, capacity);
+
+    case COMPONENT_UNSIGNED_INT:
+        return reader.ReadBinaryData<uint32_t>(doc, accessor, data, capacity);
+
+    default:
+        throw GLTFException("Invalid componentType for indices accessor " + accessor.id);
+    }
+}
+
+size_t MeshPrimitiveUtils::GetIndices32(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, uint32_t* data, size_t capacity)
+{
+    const auto& accessor = doc.accessors.Get(meshPrimitive.indicesAccessorId);
+    return GetIndices32(doc, reader, accessor, data, capacity);
+}
+
 std::vector<uint16_t> MeshPrimitiveUtils::GetTriangulatedIndices16(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
 {
     return GetTriangulatedIndices<uint16_t>(meshPrimitive.mode, GetOrCreateIndices16(doc, reader, meshPrimitive));
@@ -594,15 +811,7 @@ std::vector<uint32_t> MeshPrimitiveUtils::GetSegmentedIndices32(const Document&
 // Positions
 std::vector<float> MeshPrimitiveUtils::GetPositions(const Document& doc, const GLTFResourceReader& reader, const Accessor& positionsAccessor)
 {
-    if (positionsAccessor.type != TYPE_VEC3)
-    {
-        throw GLTFException("Invalid type for positions accessor " + positionsAccessor.id);
-    }
-
-    if (positionsAccessor.componentType != COMPONENT_FLOAT)
-    {
-        throw GLTFException("Invalid component type for positions accessor " + positionsAccessor.id);
-    }
+    ValidatePositionsAccessor(positionsAccessor);
 
     return reader.ReadFloatData(doc, positionsAccessor);
 }
@@ -619,18 +828,29 @@ std::vector<float> MeshPrimitiveUtils::GetPositions(const Document& doc, const G
     return GetPositions(doc, reader, positionsAccessor);
 }
 
+size_t MeshPrimitiveUtils::GetPositions(const Document& doc, const GLTFResourceReader& reader, const Accessor& positionsAccessor, float* data, size_t capacity)
+{
+    ValidatePositionsAccessor(positionsAccessor);
+
+    return reader.ReadFloatData(doc, positionsAccessor, data, capacity);
+}
+
+size_t MeshPrimitiveUtils::GetPositions(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, float* data, size_t capacity)
+{
+    const auto& positionsAccessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_POSITION));
+    return GetPositions(doc, reader, positionsAccessor, data, capacity);
+}
+
+size_t MeshPrimitiveUtils::GetPositions(const Document& doc, const GLTFResourceReader& reader, const MorphTarget& morphTarget, float* data, size_t capacity)
+{
+    const auto& positionsAccessor = doc.accessors.Get(morphTarget.positionsAccessorId);
+    return GetPositions(doc, reader, positionsAccessor, data, capacity);
+}
+
 // Normals
 std::vector<float> MeshPrimitiveUtils::GetNormals(const Document& doc, const GLTFResourceReader& reader, const Accessor& normalsAccessor)
 {
-    if (normalsAccessor.type != TYPE_VEC3)
-    {
-        throw GLTFException("Invalid type for normals accessor " + normalsAccessor.id);
-    }
-
-    if (normalsAccessor.componentType != COMPONENT_FLOAT)
-    {
-        throw GLTFException("Invalid component type for normals accessor " + normalsAccessor.id);
-    }
+    ValidateNormalsAccessor(normalsAccessor);
 
     return reader.ReadFloatData(doc, normalsAccessor);
 }
@@ -647,18 +867,29 @@ std::vector<float> MeshPrimitiveUtils::GetNormals(const Document& doc, const GLT
     return GetNormals(doc, reader, accessor);
 }
 
+size_t MeshPrimitiveUtils::GetNormals(const Document& doc, const GLTFResourceReader& reader, const Accessor& normalsAccessor, float* data, size_t capacity)
+{
+    ValidateNormalsAccessor(normalsAccessor);
+
+    return reader.ReadFloatData(doc, normalsAccessor, data, capacity);
+}
+
+size_t MeshPrimitiveUtils::GetNormals(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, float* data, size_t capacity)
+{
+    const auto& accessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_NORMAL));
+    return GetNormals(doc, reader, accessor, data, capacity);
+}
+
+size_t MeshPrimitiveUtils::GetNormals(const Document& doc, const GLTFResourceReader& reader, const MorphTarget& morphTarget, float* data, size_t capacity)
+{
+    const auto& accessor = doc.accessors.Get(morphTarget.normalsAccessorId);
+    return GetNormals(doc, reader, accessor, data, capacity);
+}
+
 // Tangents
 std::vector<float> MeshPrimitiveUtils::GetTangents(const Document& doc, const GLTFResourceReader& reader, const Accessor& tangentsAccessor)
 {
-    if (tangentsAccessor.type != TYPE_VEC4)
-    {
-        throw GLTFException("Invalid type for tangents accessor " + tangentsAccessor.id);
-    }
-
-    if (tangentsAccessor.componentType != COMPONENT_FLOAT)
-    {
-        throw GLTFException("Invalid component type for tangents accessor " + tangentsAccessor.id);
-    }
+    ValidateTangentsAccessor(tangentsAccessor, TYPE_VEC4);
 
     return reader.ReadFloatData(doc, tangentsAccessor);
 }
@@ -672,15 +903,7 @@ std::vector<float> MeshPrimitiveUtils::GetTangents(const Document& doc, const GL
 // Morph Target Tangents (which have a different accessor type than base mesh tangents)
 std::vector<float> MeshPrimitiveUtils::GetMorphTangents(const Document& doc, const GLTFResourceReader& reader, const Accessor& tangentsAccessor)
 {
-    if (tangentsAccessor.type != TYPE_VEC3)
-    {
-        throw GLTFException("Invalid type for tangents accessor " + tangentsAccessor.id);
-    }
-
-    if (tangentsAccessor.componentType != COMPONENT_FLOAT)
-    {
-        throw GLTFException("Invalid component type for tangents accessor " + tangentsAccessor.id);
-    }
+    ValidateTangentsAccessor(tangentsAccessor, TYPE_VEC3);
 
     return reader.ReadFloatData(doc, tangentsAccessor);
 }
@@ -691,18 +914,36 @@ std::vector<float> MeshPrimitiveUtils::GetTangents(const Document& doc, const GL
     return GetMorphTangents(doc, reader, accessor);
 }
 
+size_t MeshPrimitiveUtils::GetTangents(const Document& doc, const GLTFResourceReader& reader, const Accessor& tangentsAccessor, float* data, size_t capacity)
+{
+    ValidateTangentsAccessor(tangentsAccessor, TYPE_VEC4);
+
+    return reader.ReadFloatData(doc, tangentsAccessor, data, capacity);
+}
+
+size_t MeshPrimitiveUtils::GetTangents(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, float* data, size_t capacity)
+{
+    const auto& accessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_TANGENT));
+    return GetTangents(doc, reader, accessor, data, capacity);
+}
+
+size_t MeshPrimitiveUtils::GetTangents(const Document& doc, const GLTFResourceReader& reader, const MorphTarget& morphTarget, float* data, size_t capacity)
+{
+    const auto& accessor = doc.accessors.Get(morphTarget.tangentsAccessorId);
+    return GetMorphTangents(doc, reader, accessor, data, capacity);
+}
+
+size_t MeshPrimitiveUtils::GetMorphTangents(const Document& doc, const GLTFResourceReader& reader, const Accessor& tangentsAccessor, float* data, size_t capacity)
+{
+    ValidateTangentsAccessor(tangentsAccessor, TYPE_VEC3);
+
+    return reader.ReadFloatData(doc, tangentsAccessor, data, capacity);
+}
+
 // Texcoords
 std::vector<float> MeshPrimitiveUtils::GetTexCoords(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
 {
-    if (accessor.type != TYPE_VEC2)
-    {
-        throw GLTFException("Invalid type for texcoords accessor " + accessor.id);
-    }
-
-    if (accessor.componentType != COMPONENT_FLOAT && accessor.componentType != COMPONENT_UNSIGNED_BYTE && accessor.componentType != COMPONENT_UNSIGNED_SHORT)
-    {
-        throw GLTFException("Invalid component type for texcoords accessor " + accessor.id);
-    }
+    ValidateTexCoordsAccessor(accessor);
 
     return reader.ReadFloatData(doc, accessor);
 }
@@ -719,6 +960,25 @@ std::vector<float> MeshPrimitiveUtils::GetTexCoords_1(const Document& doc, const
     return GetTexCoords(doc, reader, accessor);
 }
 
+size_t MeshPrimitiveUtils::GetTexCoords(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, float* data, size_t capacity)
+{
+    ValidateTexCoordsAccessor(accessor);
+
+    return reader.ReadFloatData(doc, accessor, data, capacity);
+}
+
+size_t MeshPrimitiveUtils::GetTexCoords_0(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, float* data, size_t capacity)
+{
+    const auto& accessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_TEXCOORD_0));
+    return GetTexCoords(doc, reader, accessor, data, capacity);
+}
+
+size_t MeshPrimitiveUtils::GetTexCoords_1(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, float* data, size_t capacity)
+{
+    const auto& accessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_TEXCOORD_1));
+    return GetTexCoords(doc, reader, accessor, data, capacity);
+}
+
 // Colors
 std::vector<uint32_t> MeshPrimitiveUtils::GetColors(const Document& doc, const GLTFResourceReader& reader, const Accessor& colorsAccessor)
 {
@@ -0,0 +1,259 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/RandomAccessReader.h>
+
+#include <GLTFSDK/Exceptions.h>
+#include <GLTFSDK/MemoryStream.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    void ValidateRange(const std::string& name, uint64_t offset, size_t byteLength, uint64_t size)
+    {
+        if (offset > size || byteLength > size - offset)
+        {
+            throw GLTFException("Read is outside the bounds of " + name);
+        }
+    }
+}
+
+#ifdef _WIN32
+
+RandomAccessFile::RandomAccessFile(const std::string& path) :
+    m_path(path),
+    m_size(0U),
+    m_file(INVALID_HANDLE_VALUE)
+{
+    m_file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, nullptr);
+
+    if (m_file == INVALID_HANDLE_VALUE)
+    {
+        throw GLTFException("Unable to open file: " + path);
+    }
+
+    LARGE_INTEGER fileSize;
+
+    if (!GetFileSizeEx(m_file, &fileSize))
+    {
+        CloseHandle(m_file);
+        throw GLTFException("Unable to query the size of file: " + path);
+    }
+
+    m_size = static_cast<uint64_t>(fileSize.QuadPart);
+}
+
+RandomAccessFile::~RandomAccessFile()
+{
+    CloseHandle(m_file);
+}
+
+void RandomAccessFile::ReadAt(uint64_t offset, size_t byteLength, void* data) const
+{
+    ValidateRange(m_path, offset, byteLength, m_size);
+
+    auto dst = static_cast<char*>(data);
+
+    while (byteLength > 0U)
+    {
+        // The offset is specified per read, so concurrent reads of the same handle don't interfere
+        OVERLAPPED overlapped = {};
+        overlapped.Offset = static_cast<DWORD>(offset);
+        overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+
+        const DWORD bytesToRead = static_cast<DWORD>(std::min<size_t>(byteLength, std::numeric_limits<DWORD>::max()));
+        DWORD bytesRead = 0U;
+
+        if (!ReadFile(m_file, dst, bytesToRead, &bytesRead, &overlapped) || bytesRead == 0U)
+        {
+            throw GLTFException("Unable to read from file: " + m_path);
+        }
+
+        dst += bytesRead;
+        offset += bytesRead;
+        byteLength -= bytesRead;
+    }
+}
+
+#else
+
+RandomAccessFile::RandomAccessFile(const std::string& path) :
+    m_path(path),
+    m_size(0U),
+    m_file(-1)
+{
+    m_file = open(path.c_str(), O_RDONLY);
+
+    if (m_file == -1)
+    {
+        throw GLTFException("Unable to open file: " + path);
+    }
+
+    struct stat fileStat;
+
+    if (fstat(m_file, &fileStat) != 0)
+    {
+        close(m_file);
+        throw GLTFException("Unable to query the size of file: " + path);
+    }
+
+    m_size = static_cast<uint64_t>(fileStat.st_size);
+}
+
+RandomAccessFile::~RandomAccessFile()
+{
+    close(m_file);
+}
+
+void RandomAccessFile::ReadAt(uint64_t offset, size_t byteLength, void* data) const
+{
+    ValidateRange(m_path, offset, byteLength, m_size);
+
+    auto dst = static_cast<char*>(data);
+
+    while (byteLength > 0U)
+    {
+        // pread may return fewer bytes than requested (or be interrupted) so read until the range is complete
+        const ssize_t bytesRead = pread(m_file, dst, byteLength, static_cast<off_t>(offset));
+
+        if (bytesRead < 0 && errno == EINTR)
+        {
+            continue;
+        }
+
+        if (bytesRead <= 0)
+        {
+            throw GLTFException("Unable to read from file: " + m_path);
+        }
+
+        dst += bytesRead;
+        offset += static_cast<uint64_t>(bytesRead);
+        byteLength -= static_cast<size_t>(bytesRead);
+    }
+}
+
+#endif
+
+uint64_t RandomAccessFile::Size() const
+{
+    return m_size;
+}
+
+FileRandomAccessReader::FileRandomAccessReader(std::string pathBase) : m_pathBase(std::move(pathBase))
+{
+    if (!m_pathBase.empty() && m_pathBase.back() != '/' && m_pathBase.back() != '\\')
+    {
+        m_pathBase += '/';
+    }
+}
+
+void FileRandomAccessReader::ReadAt(const std::string& uri, uint64_t offset, size_t byteLength, void* data) const
+{
+    GetFile(uri)->ReadAt(offset, byteLength, data);
+}
+
+uint64_t FileRandomAccessReader::GetSize(const std::string& uri) const
+{
+    return GetFile(uri)->Size();
+}
+
+std::shared_ptr<const RandomAccessFile> FileRandomAccessReader::GetFile(const std::string& uri) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto& file = m_files[uri];
+
+    if (!file)
+    {
+        file = std::make_shared<const RandomAccessFile>(m_pathBase + uri);
+    }
+
+    return file;
+}
+
+StreamRandomAccessReader::StreamRandomAccessReader(std::shared_ptr<const IStreamReader> streamReader) : m_streamReader(std::move(streamReader))
+{
+}
+
+void StreamRandomAccessReader::ReadAt(const std::string& uri, uint64_t offset, size_t byteLength, void* data) const
+{
+    auto streamEntry = GetStreamEntry(uri);
+
+    ValidateRange(uri, offset, byteLength, streamEntry->size);
+
+    if (auto memoryStream = std::dynamic_pointer_cast<const MemoryStream>(streamEntry->stream))
+    {
+        std::memcpy(data, memoryStream->Data() + offset, byteLength);
+    }
+    else
+    {
+        std::lock_guard<std::mutex> lock(streamEntry->mutex);
+
+        // Clear any eof or fail bit set by a previous read
+        streamEntry->stream->clear();
+        streamEntry->stream->seekg(static_cast<std::streamoff>(offset), std::ios::beg);
+
+        streamEntry->stream->read(static_cast<char*>(data), static_cast<std::streamsize>(byteLength));
+
+        if (streamEntry->stream->fail())
+        {
+            throw GLTFException("Unable to read from stream: " + uri);
+        }
+    }
+}
+
+uint64_t StreamRandomAccessReader::GetSize(const std::string& uri) const
+{
+    return GetStreamEntry(uri)->size;
+}
+
+std::shared_ptr<StreamRandomAccessReader::StreamEntry> StreamRandomAccessReader::GetStreamEntry(const std::string& uri) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto& streamEntry = m_streams[uri];
+
+    if (!streamEntry)
+    {
+        auto stream = m_streamReader->GetInputStream(uri);
+
+        if (!stream || stream->fail())
+        {
+            throw GLTFException("Unable to open stream: " + uri);
+        }
+
+        stream->seekg(0, std::ios::end);
+        const auto size = stream->tellg();
+
+        if (size < 0)
+        {
+            throw GLTFException("Unable to query the size of stream: " + uri);
+        }
+
+        streamEntry = std::make_shared<StreamEntry>();
+        streamEntry->stream = std::move(stream);
+        streamEntry->size = static_cast<uint64_t>(size);
+    }
+
+    return streamEntry;
+}
@@ -0,0 +1,185 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/ReadPlan.h>
+
+#include <GLTFSDK/Document.h>
+#include <GLTFSDK/ResourceReaderUtils.h>
+#include <GLTFSDK/Visitor.h>
+
+#include <algorithm>
+#include <tuple>
+
+using namespace Microsoft::glTF;
+
+ReadPlan::ReadPlan(size_t maxGapByteLength) : m_maxGapByteLength(maxGapByteLength)
+{
+}
+
+void ReadPlan::AddBufferRange(const std::string& bufferId, size_t byteOffset, size_t byteLength)
+{
+    if (byteLength > 0U)
+    {
+        m_bufferRanges.push_back({ bufferId, byteOffset, byteLength });
+    }
+}
+
+void ReadPlan::AddBufferView(const BufferView& bufferView)
+{
+    AddBufferRange(bufferView.bufferId, bufferView.byteOffset, bufferView.byteLength);
+}
+
+void ReadPlan::AddAccessor(const Document& document, const Accessor& accessor)
+{
+    const size_t elementSize = static_cast<size_t>(Accessor::GetComponentTypeSize(accessor.componentType)) * Accessor::GetTypeCount(accessor.type);
+
+    if (!accessor.bufferViewId.empty() && accessor.count > 0U)
+    {
+        const BufferView& bufferView = document.bufferViews.Get(accessor.bufferViewId);
+
+        const size_t byteStride = bufferView.byteStride ? bufferView.byteStride.Get() : elementSize;
+        const size_t byteLength = (accessor.count - 1U) * byteStride + elementSize;
+
+        AddBufferRange(bufferView.bufferId, bufferView.byteOffset + accessor.byteOffset, byteLength);
+    }
+
+    if (accessor.sparse.count > 0U)
+    {
+        const BufferView& indicesBufferView = document.bufferViews.Get(accessor.sparse.indicesBufferViewId);
+        const BufferView& valuesBufferView = document.bufferViews.Get(accessor.sparse.valuesBufferViewId);
+
+        AddBufferRange(indicesBufferView.bufferId,
+            indicesBufferView.byteOffset + accessor.sparse.indicesByteOffset,
+            accessor.sparse.count * Accessor::GetComponentTypeSize(accessor.sparse.indicesComponentType));
+
+        AddBufferRange(valuesBufferView.bufferId,
+            valuesBufferView.byteOffset + accessor.sparse.valuesByteOffset,
+            accessor.sparse.count * elementSize);
+    }
+}
+
+void ReadPlan::AddMeshPrimitive(const Document& document, const MeshPrimitive& meshPrimitive)
+{
+    if (!meshPrimitive.indicesAccessorId.empty())
+    {
+        AddAccessor(document, document.accessors.Get(meshPrimitive.indicesAccessorId));
+    }
+
+    for (const auto& attribute : meshPrimitive.attributes)
+    {
+        AddAccessor(document, document.accessors.Get(attribute.second));
+    }
+
+    for (const auto& morphTarget : meshPrimitive.targets)
+    {
+        for (const auto* accessorId : { &morphTarget.positionsAccessorId, &morphTarget.normalsAccessorId, &morphTarget.tangentsAccessorId })
+        {
+            if (!accessorId->empty())
+            {
+                AddAccessor(document, document.accessors.Get(*accessorId));
+            }
+        }
+    }
+}
+
+void ReadPlan::AddMesh(const Document& document, const Mesh& mesh)
+{
+    for (const auto& meshPrimitive : mesh.primitives)
+    {
+        AddMeshPrimitive(document, meshPrimitive);
+    }
+}
+
+void ReadPlan::AddSkin(const Document& document, const Skin& skin)
+{
+    if (!skin.inverseBindMatricesAccessorId.empty())
+    {
+        AddAccessor(document, document.accessors.Get(skin.inverseBindMatricesAccessorId));
+    }
+}
+
+void ReadPlan::AddImage(const Document& document, const Image& image)
+{
+    if (image.uri.empty())
+    {
+        if (!image.bufferViewId.empty())
+        {
+            AddBufferView(document.bufferViews.Get(image.bufferViewId));
+        }
+    }
+    else if (!IsUriBase64(image.uri) && std::find(m_imageUris.begin(), m_imageUris.end(), image.uri) == m_imageUris.end())
+    {
+        m_imageUris.push_back(image.uri);
+    }
+}
+
+void ReadPlan::AddScene(const Document& document, size_t sceneIndex)
+{
+    // The visit state of a mesh primitive is that of its mesh, so the primitives of a mesh referenced by
+    // multiple nodes are only added once
+    Visit(document, sceneIndex,
+        [this, &document](const MeshPrimitive& meshPrimitive, VisitState visitState)
+    {
+        if (visitState == VisitState::New)
+        {
+            AddMeshPrimitive(document, meshPrimitive);
+        }
+    },
+        [this, &document](const Skin& skin, VisitState visitState)
+    {
+        if (visitState == VisitState::New)
+        {
+            AddSkin(document, skin);
+        }
+    },
+        [this, &document](const Image& image, VisitState visitState)
+    {
+        if (visitState == VisitState::New)
+        {
+            AddImage(document, image);
+        }
+    });
+}
+
+std::vector<BufferRange> ReadPlan::GetBufferRanges() const
+{
+    auto bufferRanges = m_bufferRanges;
+
+    std::sort(bufferRanges.begin(), bufferRanges.end(), [](const BufferRange& lhs, const BufferRange& rhs)
+    {
+        return std::tie(lhs.bufferId, lhs.byteOffset) < std::tie(rhs.bufferId, rhs.byteOffset);
+    });
+
+    std::vector<BufferRange> mergedRanges;
+
+    for (const auto& bufferRange : bufferRanges)
+    {
+        if (!mergedRanges.empty())
+        {
+            auto& mergedRange = mergedRanges.back();
+
+            const size_t mergedEnd = mergedRange.byteOffset + mergedRange.byteLength;
+
+            // Overlapping, adjacent or nearby (within the maximum gap) ranges are merged into a single range
+            if (mergedRange.bufferId == bufferRange.bufferId && bufferRange.byteOffset <= mergedEnd + m_maxGapByteLength)
+            {
+                mergedRange.byteLength = std::max(mergedEnd, bufferRange.byteOffset + bufferRange.byteLength) - mergedRange.byteOffset;
+                continue;
+            }
+        }
+
+        mergedRanges.push_back(bufferRange);
+    }
+
+    return mergedRanges;
+}
+
+const std::vector<std::string>& ReadPlan::GetImageUris() const
+{
+    return m_imageUris;
+}
+
+bool ReadPlan::IsEmpty() const
+{
+    return m_bufferRanges.empty() && m_imageUris.empty();
+}
@@ -0,0 +1,448 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/ResourceReaderUtils.h>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GLTFSDK_CONVERT_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define GLTFSDK_BASE64_SSSE3
+
+#include <tmmintrin.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define GLTFSDK_TARGET_SSSE3
+#else
+#define GLTFSDK_TARGET_SSSE3 __attribute__((target("ssse3")))
+#endif
+#endif
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    const uint8_t InvalidChar = std::numeric_limits<uint8_t>::max();
+
+    // Maps every possible char value (not just the ASCII range covered by GetDecodeTable) so no separate range check
+    // is required
+    struct DecodeTable
+    {
+        DecodeTable()
+        {
+            const auto asciiDecodeTable = GetDecodeTable();
+
+            std::fill(std::copy(asciiDecodeTable.begin(), asciiDecodeTable.end(), std::begin(values)), std::end(values), InvalidChar);
+        }
+
+        uint8_t operator[](char encodedChar) const
+        {
+            return values[static_cast<uint8_t>(encodedChar)];
+        }
+
+        uint8_t values[256];
+    };
+
+    const DecodeTable& GetDecodeTable256()
+    {
+        static const DecodeTable decodeTable;
+        return decodeTable;
+    }
+
+    // Decodes 4 characters to 3 bytes. Each character's value is OR'd together so that only a single
+    // test is required to detect whether any of them are invalid.
+    void DecodeGroup(const DecodeTable& decodeTable, const char* encodedChars, uint8_t* decodedBytes)
+    {
+        const uint32_t c0 = decodeTable[encodedChars[0]];
+        const uint32_t c1 = decodeTable[encodedChars[1]];
+        const uint32_t c2 = decodeTable[encodedChars[2]];
+        const uint32_t c3 = decodeTable[encodedChars[3]];
+
+        if ((c0 | c1 | c2 | c3) == InvalidChar)
+        {
+            throw GLTFException("Invalid base64 character");
+        }
+
+        const uint32_t block = (c0 << 18) | (c1 << 12) | (c2 << 6) | c3;
+
+        decodedBytes[0] = static_cast<uint8_t>(block >> 16);
+        decodedBytes[1] = static_cast<uint8_t>(block >> 8);
+        decodedBytes[2] = static_cast<uint8_t>(block);
+    }
+
+    // Decodes a group of between 1 and 4 characters (i.e. the final group of an unpadded string) into the
+    // 3 byte group buffer. Returns the number of bytes that were encoded by the group's characters.
+    size_t DecodePartialGroup(const DecodeTable& decodeTable, const char* encodedChars, size_t charCount, uint8_t* group)
+    {
+        char paddedChars[4] = { 'A', 'A', 'A', 'A' };// 'A' decodes to zero
+
+        std::copy(encodedChars, encodedChars + charCount, paddedChars);
+        DecodeGroup(decodeTable, paddedChars, group);
+
+        return CharCountToByteCount(charCount);
+    }
+
+#ifdef GLTFSDK_BASE64_SSSE3
+    bool IsSsse3Supported()
+    {
+#if defined(_MSC_VER)
+        int cpuInfo[4];
+        __cpuid(cpuInfo, 1);
+        return (cpuInfo[2] & (1 << 9)) != 0;
+#else
+        return __builtin_cpu_supports("ssse3") != 0;
+#endif
+    }
+
+    // Decodes 16 characters at a time into 12 bytes (using the approach described by Wojciech Mula and Alfred
+    // Klomp). Returns the number of 4 character groups decoded, which may be fewer than groupCount. Decoding
+    // stops early if any invalid characters are encountered, the scalar implementation then reports the error.
+    // Each iteration writes 16 bytes so the final groups are always left to the scalar implementation.
+    GLTFSDK_TARGET_SSSE3 size_t DecodeGroupsSsse3(const char* encodedChars, uint8_t* decodedBytes, size_t groupCount)
+    {
+        const __m128i lutLo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+        const __m128i lutHi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+        const __m128i lutRoll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+        const __m128i mask2F = _mm_set1_epi8(0x2F);
+        const __m128i packShuffle = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+        size_t groupsDecoded = 0U;
+
+        // Leave at least 2 groups (6 bytes) after each iteration's 12 bytes for the 4 bytes of overrun
+        while (groupCount - groupsDecoded >= 6U)
+        {
+            __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(encodedChars));
+
+            const __m128i hiNibbles = _mm_and_si128(_mm_srli_epi32(chars, 4), mask2F);
+            const __m128i loNibbles = _mm_and_si128(chars, mask2F);
+            const __m128i hi = _mm_shuffle_epi8(lutHi, hiNibbles);
+            const __m128i lo = _mm_shuffle_epi8(lutLo, loNibbles);
+
+            // A character is invalid if its lookups via its low and high nibbles share any bits
+            if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128())) != 0)
+            {
+                break;
+            }
+
+            const __m128i eq2F = _mm_cmpeq_epi8(chars, mask2F);
+            const __m128i roll = _mm_shuffle_epi8(lutRoll, _mm_add_epi8(eq2F, hiNibbles));
+
+            // Translate each character to its 6 bit value then pack each group's 24 bits into 3 bytes
+            chars = _mm_add_epi8(chars, roll);
+            chars = _mm_maddubs_epi16(chars, _mm_set1_epi32(0x01400140));
+            chars = _mm_madd_epi16(chars, _mm_set1_epi32(0x00011000));
+            chars = _mm_shuffle_epi8(chars, packShuffle);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(decodedBytes), chars);
+
+            encodedChars += 16U;
+            decodedBytes += 12U;
+            groupsDecoded += 4U;
+        }
+
+        return groupsDecoded;
+    }
+#endif
+}
+
+namespace
+{
+    template<typename T>
+    void ComponentsToFloatsScalar(const T* components, size_t count, float* floats)
+    {
+        for (size_t i = 0U; i < count; ++i)
+        {
+            floats[i] = ComponentToFloat(components[i]);
+        }
+    }
+
+    template<typename T>
+    void FloatsToComponentsScalar(const float* floats, size_t count, T* components, float floatMin)
+    {
+        for (size_t i = 0U; i < count; ++i)
+        {
+            // NaNs are clamped to floatMin, consistent with the SSE2 implementation
+            const float f = floats[i] > 1.0f ? 1.0f : (floats[i] >= floatMin ? floats[i] : floatMin);
+            components[i] = FloatToComponent<T>(f);
+        }
+    }
+
+#ifdef GLTFSDK_CONVERT_SSE2
+    // Each function below converts 4 components. Division (rather than multiplication by a reciprocal) and
+    // the clamp to -1 match ComponentToFloat exactly.
+    inline void StoreSignedAsFloats(__m128i values, __m128 scale, float* floats)
+    {
+        const __m128 f = _mm_div_ps(_mm_cvtepi32_ps(values), scale);
+        _mm_storeu_ps(floats, _mm_max_ps(f, _mm_set1_ps(-1.0f)));
+    }
+
+    inline void StoreUnsignedAsFloats(__m128i values, __m128 scale, float* floats)
+    {
+        _mm_storeu_ps(floats, _mm_div_ps(_mm_cvtepi32_ps(values), scale));
+    }
+
+    // Clamps the floats to [floatMin, 1], scales them and rounds half away from zero (as std::round does).
+    // Adding the largest float less than 0.5 before truncating avoids rounding 0.49999997 up to 1.
+    inline __m128i ScaleAndRound(const float* floats, __m128 floatMin, __m128 scale)
+    {
+        const __m128 clamped = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(floats), floatMin), _mm_set1_ps(1.0f));
+        const __m128 scaled = _mm_mul_ps(clamped, scale);
+        const __m128 half = _mm_or_ps(_mm_and_ps(scaled, _mm_set1_ps(-0.0f)), _mm_set1_ps(0.49999997f));
+
+        return _mm_cvttps_epi32(_mm_add_ps(scaled, half));
+    }
+#endif
+}
+
+void Microsoft::glTF::ComponentsToFloats(const int8_t* components, size_t count, float* floats)
+{
+    size_t i = 0U;
+
+#ifdef GLTFSDK_CONVERT_SSE2
+    const __m128 scale = _mm_set1_ps(127.0f);
+
+    for (; i + 16U <= count; i += 16U)
+    {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(components + i));
+
+        // Sign extend by unpacking each value into the high half of a wider lane then arithmetic shifting
+        const __m128i lo = _mm_srai_epi16(_mm_unpacklo_epi8(bytes, bytes), 8);
+        const __m128i hi = _mm_srai_epi16(_mm_unpackhi_epi8(bytes, bytes), 8);
+
+        StoreSignedAsFloats(_mm_srai_epi32(_mm_unpacklo_epi16(lo, lo), 16), scale, floats + i);
+        StoreSignedAsFloats(_mm_srai_epi32(_mm_unpackhi_epi16(lo, lo), 16), scale, floats + i + 4U);
+        StoreSignedAsFloats(_mm_srai_epi32(_mm_unpacklo_epi16(hi, hi), 16), scale, floats + i + 8U);
+        StoreSignedAsFloats(_mm_srai_epi32(_mm_unpackhi_epi16(hi, hi), 16), scale, floats + i + 12U);
+    }
+#endif
+
+    ComponentsToFloatsScalar(components + i, count - i, floats + i);
+}
+
+void Microsoft::glTF::ComponentsToFloats(const uint8_t* components, size_t count, float* floats)
+{
+    size_t i = 0U;
+
+#ifdef GLTFSDK_CONVERT_SSE2
+    const __m128 scale = _mm_set1_ps(255.0f);
+    const __m128i zero = _mm_setzero_si128();
+
+    for (; i + 16U <= count; i += 16U)
+    {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(components + i));
+
+        const __m128i lo = _mm_unpacklo_epi8(bytes, zero);
+        const __m128i hi = _mm_unpackhi_epi8(bytes, zero);
+
+        StoreUnsignedAsFloats(_mm_unpacklo_epi16(lo, zero), scale, floats + i);
+        StoreUnsignedAsFloats(_mm_unpackhi_epi16(lo, zero), scale, floats + i + 4U);
+        StoreUnsignedAsFloats(_mm_unpacklo_epi16(hi, zero), scale, floats + i + 8U);
+        StoreUnsignedAsFloats(_mm_unpackhi_epi16(hi, zero), scale, floats + i + 12U);
+    }
+#endif
+
+    ComponentsToFloatsScalar(components + i, count - i, floats + i);
+}
+
+void Microsoft::glTF::ComponentsToFloats(const int16_t* components, size_t count, float* floats)
+{
+    size_t i = 0U;
+
+#ifdef GLTFSDK_CONVERT_SSE2
+    const __m128 scale = _mm_set1_ps(32767.0f);
+
+    for (; i + 8U <= count; i += 8U)
+    {
+        const __m128i shorts = _mm_loadu_si128(reinterpret_cast<const __m128i*>(components + i));
+
+        StoreSignedAsFloats(_mm_srai_epi32(_mm_unpacklo_epi16(shorts, shorts), 16), scale, floats + i);
+        StoreSignedAsFloats(_mm_srai_epi32(_mm_unpackhi_epi16(shorts, shorts), 16), scale, floats + i + 4U);
+    }
+#endif
+
+    ComponentsToFloatsScalar(components + i, count - i, floats + i);
+}
+
+void Microsoft::glTF::ComponentsToFloats(const uint16_t* components, size_t count, float* floats)
+{
+    size_t i = 0U;
+
+#ifdef GLTFSDK_CONVERT_SSE2
+    const __m128 scale = _mm_set1_ps(65535.0f);
+    const __m128i zero = _mm_setzero_si128();
+
+    for (; i + 8U <= count; i += 8U)
+    {
+        const __m128i shorts = _mm_loadu_si128(reinterpret_cast<const __m128i*>(components + i));
+
+        StoreUnsignedAsFloats(_mm_unpacklo_epi16(shorts, zero), scale, floats + i);
+        StoreUnsignedAsFloats(_mm_unpackhi_epi16(shorts, zero), scale, floats + i + 4U);
+    }
+#endif
+
+    ComponentsToFloatsScalar(components + i, count - i, floats + i);
+}
+
+void Microsoft::glTF::FloatsToComponents(const float* floats, size_t count, int8_t* components)
+{
+    size_t i = 0U;
+
+#ifdef GLTFSDK_CONVERT_SSE2
+    const __m128 floatMin = _mm_set1_ps(-1.0f);
+    const __m128 scale = _mm_set1_ps(127.0f);
+
+    for (; i + 16U <= count; i += 16U)
+    {
+        const __m128i lo = _mm_packs_epi32(ScaleAndRound(floats + i, floatMin, scale), ScaleAndRound(floats + i + 4U, floatMin, scale));
+        const __m128i hi = _mm_packs_epi32(ScaleAndRound(floats + i + 8U, floatMin, scale), ScaleAndRound(floats + i + 12U, floatMin, scale));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(components + i), _mm_packs_epi16(lo, hi));
+    }
+#endif
+
+    FloatsToComponentsScalar(floats + i, count - i, components + i, -1.0f);
+}
+
+void Microsoft::glTF::FloatsToComponents(const float* floats, size_t count, uint8_t* components)
+{
+    size_t i = 0U;
+
+#ifdef GLTFSDK_CONVERT_SSE2
+    const __m128 floatMin = _mm_setzero_ps();
+    const __m128 scale = _mm_set1_ps(255.0f);
+
+    for (; i + 16U <= count; i += 16U)
+    {
+        const __m128i lo = _mm_packs_epi32(ScaleAndRound(floats + i, floatMin, scale), ScaleAndRound(floats + i + 4U, floatMin, scale));
+        const __m128i hi = _mm_packs_epi32(ScaleAndRound(floats + i + 8U, floatMin, scale), ScaleAndRound(floats + i + 12U, floatMin, scale));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(components + i), _mm_packus_epi16(lo, hi));
+    }
+#endif
+
+    FloatsToComponentsScalar(floats + i, count - i, components + i, 0.0f);
+}
+
+void Microsoft::glTF::FloatsToComponents(const float* floats, size_t count, int16_t* components)
+{
+    size_t i = 0U;
+
+#ifdef GLTFSDK_CONVERT_SSE2
+    const __m128 floatMin = _mm_set1_ps(-1.0f);
+    const __m128 scale = _mm_set1_ps(32767.0f);
+
+    for (; i + 8U <= count; i += 8U)
+    {
+        const __m128i shorts = _mm_packs_epi32(ScaleAndRound(floats + i, floatMin, scale), ScaleAndRound(floats + i + 4U, floatMin, scale));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(components + i), shorts);
+    }
+#endif
+
+    FloatsToComponentsScalar(floats + i, count - i, components + i, -1.0f);
+}
+
+void Microsoft::glTF::FloatsToComponents(const float* floats, size_t count, uint16_t* components)
+{
+    size_t i = 0U;
+
+#ifdef GLTFSDK_CONVERT_SSE2
+    const __m128 floatMin = _mm_setzero_ps();
+    const __m128 scale = _mm_set1_ps(65535.0f);
+
+    // SSE2 has no unsigned saturating 32 to 16 bit pack. Offsetting the (already clamped) values into the signed
+    // range lets a signed pack be used instead, the offset is then removed from each 16 bit result.
+    const __m128i offset32 = _mm_set1_epi32(32768);
+    const __m128i offset16 = _mm_set1_epi16(static_cast<short>(0x8000));
+
+    for (; i + 8U <= count; i += 8U)
+    {
+        const __m128i lo = _mm_sub_epi32(ScaleAndRound(floats + i, floatMin, scale), offset32);
+        const __m128i hi = _mm_sub_epi32(ScaleAndRound(floats + i + 4U, floatMin, scale), offset32);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(components + i), _mm_xor_si128(_mm_packs_epi32(lo, hi), offset16));
+    }
+#endif
+
+    FloatsToComponentsScalar(floats + i, count - i, components + i, 0.0f);
+}
+
+void Microsoft::glTF::Base64Decode(Base64StringView encodedData, Base64BufferView decodedData, size_t bytesToSkip)
+{
+    if (encodedData.GetByteCount() != (decodedData.bufferByteLength + bytesToSkip))
+    {
+        throw GLTFException("The specified decode buffer's size is incorrect");
+    }
+
+    size_t charCount = encodedData.GetCharCount();
+
+    if (charCount == 0U)
+    {
+        return;
+    }
+
+    const DecodeTable& decodeTable = GetDecodeTable256();
+
+    const char* encodedChars = &*encodedData.begin();
+    uint8_t* decodedBytes = static_cast<uint8_t*>(decodedData.buffer);
+
+    // Groups of characters that only encode skipped bytes don't need to be decoded
+    const size_t groupsToSkip = bytesToSkip / 3U;
+
+    encodedChars += groupsToSkip * 4U;
+    charCount -= groupsToSkip * 4U;
+    bytesToSkip -= groupsToSkip * 3U;
+
+    if (bytesToSkip > 0U)
+    {
+        uint8_t group[3];
+
+        const size_t groupCharCount = std::min<size_t>(charCount, 4U);
+        const size_t groupByteCount = DecodePartialGroup(decodeTable, encodedChars, groupCharCount, group);
+
+        std::memcpy(decodedBytes, group + bytesToSkip, groupByteCount - bytesToSkip);
+
+        encodedChars += groupCharCount;
+        decodedBytes += groupByteCount - bytesToSkip;
+        charCount -= groupCharCount;
+    }
+
+    const size_t groupCount = charCount / 4U;
+
+    size_t groupsDecoded = 0U;
+
+#ifdef GLTFSDK_BASE64_SSSE3
+    static const bool isSsse3Supported = IsSsse3Supported();
+
+    if (isSsse3Supported)
+    {
+        groupsDecoded = DecodeGroupsSsse3(encodedChars, decodedBytes, groupCount);
+    }
+#endif
+
+    for (; groupsDecoded < groupCount; ++groupsDecoded)
+    {
+        DecodeGroup(decodeTable, encodedChars + groupsDecoded * 4U, decodedBytes + groupsDecoded * 3U);
+    }
+
+    encodedChars += groupCount * 4U;
+    decodedBytes += groupCount * 3U;
+    charCount -= groupCount * 4U;
+
+    if (charCount > 0U)
+    {
+        uint8_t group[3];
+
+        const size_t groupByteCount = DecodePartialGroup(decodeTable, encodedChars, charCount, group);
+
+        std::memcpy(decodedBytes, group, groupByteCount);
+    }
+}
@@ -4,82 +4,79 @@
 #include <GLTFSDK/SchemaValidation.h>
 #include <GLTFSDK/Exceptions.h>
 
-#include <unordered_map>
+#include <type_traits>
 
 using namespace Microsoft::glTF;
 
-namespace
+SchemaCache::SchemaCache(std::unique_ptr<const ISchemaLocator> schemaLocator) : m_schemaLocator(std::move(schemaLocator))
 {
-    class RemoteSchemaDocumentProvider : public rapidjson::IRemoteSchemaDocumentProvider
+    if (!m_schemaLocator)
     {
-    public:
-        RemoteSchemaDocumentProvider(std::unique_ptr<const ISchemaLocator> schemaLocator) : schemaLocator(std::move(schemaLocator))
-        {
-            assert(this->schemaLocator);
-        }
-
-        const rapidjson::SchemaDocument* GetRemoteDocumentStr(const std::string& uri)
-        {
-            auto itDoc = schemaDocuments.find(uri);
-
-            if (itDoc != schemaDocuments.end())
-            {
-                return &(itDoc->second);
-            }
-
-            rapidjson::Document document;
-
-            if (document.Parse(schemaLocator->GetSchemaContent(uri)).HasParseError())
-            {
-                throw GLTFException("Schema document at " + uri + " is not valid JSON");
-            }
-
-            auto result = schemaDocuments.emplace(uri, rapidjson::SchemaDocument(document, nullptr, 0));
-            assert(result.second);
-            auto resultSchemaDoc = &(result.first->second);
-            assert(resultSchemaDoc);
-
-            return resultSchemaDoc;
-        }
-
-        const rapidjson::SchemaDocument* GetRemoteDocument(const char* uri, rapidjson::SizeType length) override
-        {
-            return GetRemoteDocumentStr(std::string(uri, length));
-        }
-
-        const std::unique_ptr<const ISchemaLocator> schemaLocator;
-
-    private:
-        std::unordered_map<std::string, rapidjson::SchemaDocument> schemaDocuments;
-    };
+        throw GLTFException("ISchemaLocator instance must not be null");
+    }
 }
 
-void Microsoft::glTF::ValidateDocumentAgainstSchema(const rapidjson::Document& document, const std::string& schemaUri, std::unique_ptr<const ISchemaLocator> schemaLocator)
+const rapidjson::SchemaDocument& SchemaCache::GetSchemaDocument(const std::string& uri) const
 {
-    if (!schemaLocator)
+    // Compilation happens while the lock is held so each schema is only ever compiled once. References to the
+    // elements of an unordered_map remain valid as it grows so the returned SchemaDocument can be used unlocked.
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto itDoc = m_schemaDocuments.find(uri);
+
+    if (itDoc != m_schemaDocuments.end())
     {
-        throw GLTFException("ISchemaLocator instance must not be null");
+        return itDoc->second;
+    }
+
+    const char* schemaContent = m_schemaLocator->GetSchemaContent(uri);
+
+    if (!schemaContent)
+    {
+        throw GLTFException("Schema document at " + uri + " could not be located");
     }
 
-    RemoteSchemaDocumentProvider provider(std::move(schemaLocator));
+    rapidjson::Document document;
 
-    if (auto* schemaDocument = provider.GetRemoteDocumentStr(schemaUri))
+    if (document.Parse(schemaContent).HasParseError())
     {
-        rapidjson::SchemaValidator schemaValidator(*schemaDocument);
+        throw GLTFException("Schema document at " + uri + " is not valid JSON");
+    }
+
+    auto result = m_schemaDocuments.emplace(uri, rapidjson::SchemaDocument(document, nullptr, 0));
+    assert(result.second);
+
+    return result.first->second;
+}
+
+std::shared_ptr<const SchemaCache> Microsoft::glTF::GetDefaultSchemaCache(SchemaFlags schemaFlags)
+{
+    static std::mutex mutex;
+    static std::unordered_map<std::underlying_type_t<SchemaFlags>, std::shared_ptr<const SchemaCache>> schemaCaches;
 
-        if (!document.Accept(schemaValidator))
-        {
-            rapidjson::StringBuffer sb;
+    std::lock_guard<std::mutex> lock(mutex);
 
-            const std::string schemaKeyword = schemaValidator.GetInvalidSchemaKeyword();
-            schemaValidator.GetInvalidDocumentPointer().StringifyUriFragment(sb);
-            const std::string schemaInvalid = sb.GetString();
+    auto& schemaCache = schemaCaches[static_cast<std::underlying_type_t<SchemaFlags>>(schemaFlags)];
 
-            throw ValidationException("Schema violation at " + schemaInvalid + " due to " + schemaKeyword);
-        }
+    if (!schemaCache)
+    {
+        schemaCache = std::make_shared<const SchemaCache>(GetDefaultSchemaLocator(schemaFlags));
     }
-    else
+
+    return schemaCache;
+}
+
+void Microsoft::glTF::ValidateDocumentAgainstSchema(const rapidjson::Value& document, const std::string& schemaUri, std::unique_ptr<const ISchemaLocator> schemaLocator)
+{
+    ValidateDocumentAgainstSchema(document, schemaUri, SchemaCache(std::move(schemaLocator)));
+}
+
+void Microsoft::glTF::ValidateDocumentAgainstSchema(const rapidjson::Value& document, const std::string& schemaUri, const SchemaCache& schemaCache)
+{
+    rapidjson::SchemaValidator schemaValidator(schemaCache.GetSchemaDocument(schemaUri));
+
+    if (!document.Accept(schemaValidator))
     {
-        throw GLTFException("Schema document at " + schemaUri + " could not be located");
+        ThrowSchemaViolation(schemaValidator);
     }
 }
@@ -6,7 +6,9 @@
 #include <GLTFSDK/Document.h>
 #include <GLTFSDK/ExtensionHandlers.h>
 #include <GLTFSDK/GLTF.h>
+#include <GLTFSDK/JsonArena.h>
 #include <GLTFSDK/RapidJsonUtils.h>
+#include <GLTFSDK/StreamUtils.h>
 
 using namespace Microsoft::glTF;
 
@@ -825,9 +827,9 @@ namespace
         SerializeStringSet("extensionsRequired", gltfDocument.extensionsRequired, document);
     }
 
-    rapidjson::Document CreateJsonDocument(const Document& gltfDocument, const ExtensionSerializer& extensionSerializer)
+    rapidjson::Document CreateJsonDocument(const Document& gltfDocument, const ExtensionSerializer& extensionSerializer, rapidjson::MemoryPoolAllocator<>* allocator = nullptr)
     {
-        rapidjson::Document document(rapidjson::kObjectType);
+        rapidjson::Document document(rapidjson::kObjectType, allocator);
 
         SerializeAsset(gltfDocument, document, extensionSerializer);
 
@@ -859,6 +861,179 @@ namespace
     {
         return ((flags & flag) == flag);
     }
+
+    template<typename TStringBuffer>
+    void WriteJsonDocument(const rapidjson::Document& document, TStringBuffer& stringBuffer, SerializeFlags flags)
+    {
+        if (HasFlag(flags, SerializeFlags::Pretty))
+        {
+            rapidjson::PrettyWriter<TStringBuffer> writer(stringBuffer);
+            document.Accept(writer);
+        }
+        else
+        {
+            rapidjson::Writer<TStringBuffer> writer(stringBuffer);
+            document.Accept(writer);
+        }
+    }
+
+    // Buffers output in fixed size blocks so a SAX writer doesn't make a (virtual) stream call per character
+    class OStreamBuffer
+    {
+    public:
+        typedef char Ch;
+
+        explicit OStreamBuffer(std::ostream& stream) : m_stream(stream), m_buffer(65536U), m_size(0U)
+        {
+        }
+
+        void Put(Ch c)
+        {
+            if (m_size == m_buffer.size())
+            {
+                Flush();
+            }
+
+            m_buffer[m_size++] = c;
+        }
+
+        void Flush()
+        {
+            if (m_size > 0U)
+            {
+                StreamUtils::WriteBinary(m_stream, m_buffer.data(), m_size);
+                m_size = 0U;
+            }
+        }
+
+    private:
+        std::ostream& m_stream;
+        std::vector<Ch> m_buffer;
+        size_t m_size;
+    };
+
+    // Discards output, only counting its length
+    class CountingStream
+    {
+    public:
+        typedef char Ch;
+
+        CountingStream() : m_length(0U)
+        {
+        }
+
+        void Put(Ch)
+        {
+            ++m_length;
+        }
+
+        void Flush()
+        {
+        }
+
+        size_t GetLength() const
+        {
+            return m_length;
+        }
+
+    private:
+        size_t m_length;
+    };
+
+    // Writes the members accumulated in the scratch document, then empties it and releases its memory
+    template<typename TWriter>
+    void WriteJsonMembers(rapidjson::Document& scratch, TWriter& writer)
+    {
+        for (auto it = scratch.MemberBegin(); it != scratch.MemberEnd(); ++it)
+        {
+            writer.Key(it->name.GetString(), it->name.GetStringLength());
+            it->value.Accept(writer);
+        }
+
+        // SetObject discards the member array, which was allocated from the pool being cleared
+        scratch.SetObject();
+        scratch.GetAllocator().Clear();
+    }
+
+    template<typename T, typename TWriter>
+    void WriteIndexedContainer(
+        const char* name,
+        const IndexedContainer<const T>& indexedContainer,
+        const Document& gltfDocument,
+        rapidjson::Document& scratch,
+        const ExtensionSerializer& ext,
+        rapidjson::Value(*fn)(const T&, const Document&, rapidjson::Document&, const ExtensionSerializer&),
+        TWriter& writer)
+    {
+        if (indexedContainer.Size() > 0)
+        {
+            writer.Key(name);
+            writer.StartArray();
+
+            for (const auto& containerElement : indexedContainer.Elements())
+            {
+                fn(containerElement, gltfDocument, scratch, ext).Accept(writer);
+                scratch.GetAllocator().Clear();
+            }
+
+            writer.EndArray();
+        }
+    }
+
+    // Produces the same sequence of SAX events as CreateJsonDocument followed by Accept, but each top level property
+    // (or array element) is built in a scratch document and written out immediately
+    template<typename TWriter>
+    void WriteJson(const Document& gltfDocument, const ExtensionSerializer& extensionSerializer, TWriter& writer)
+    {
+        rapidjson::Document scratch(rapidjson::kObjectType);
+
+        writer.StartObject();
+
+        SerializeAsset(gltfDocument, scratch, extensionSerializer);
+        WriteJsonMembers(scratch, writer);
+
+        WriteIndexedContainer<Accessor>("accessors", gltfDocument.accessors, gltfDocument, scratch, extensionSerializer, SerializeAccessor, writer);
+        WriteIndexedContainer<Animation>("animations", gltfDocument.animations, gltfDocument, scratch, extensionSerializer, SerializeAnimation, writer);
+        WriteIndexedContainer<BufferView>("bufferViews", gltfDocument.bufferViews, gltfDocument, scratch, extensionSerializer, SerializeBufferView, writer);
+        WriteIndexedContainer<Buffer>("buffers", gltfDocument.buffers, gltfDocument, scratch, extensionSerializer, SerializeBuffer, writer);
+        WriteIndexedContainer<Camera>("cameras", gltfDocument.cameras, gltfDocument, scratch, extensionSerializer, SerializeCamera, writer);
+        WriteIndexedContainer<Image>("images", gltfDocument.images, gltfDocument, scratch, extensionSerializer, SerializeImage, writer);
+        WriteIndexedContainer<Material>("materials", gltfDocument.materials, gltfDocument, scratch, extensionSerializer, SerializeMaterial, writer);
+        WriteIndexedContainer<Mesh>("meshes", gltfDocument.meshes, gltfDocument, scratch, extensionSerializer, SerializeMesh, writer);
+        WriteIndexedContainer<Node>("nodes", gltfDocument.nodes, gltfDocument, scratch, extensionSerializer, SerializeNode, writer);
+        WriteIndexedContainer<Sampler>("samplers", gltfDocument.samplers, gltfDocument, scratch, extensionSerializer, SerializeSampler, writer);
+        WriteIndexedContainer<Scene>("scenes", gltfDocument.scenes, gltfDocument, scratch, extensionSerializer, SerializeScene, writer);
+        WriteIndexedContainer<Skin>("skins", gltfDocument.skins, gltfDocument, scratch, extensionSerializer, SerializeSkin, writer);
+        WriteIndexedContainer<Texture>("textures", gltfDocument.textures, gltfDocument, scratch, extensionSerializer, SerializeTexture, writer);
+
+        SerializeDefaultScene(gltfDocument, scratch);
+
+        SerializeExtensions(gltfDocument, scratch, extensionSerializer);
+
+        SerializeExtensionsUsed(gltfDocument, scratch);
+        SerializeExtensionsRequired(gltfDocument, scratch);
+
+        WriteJsonMembers(scratch, writer);
+
+        writer.EndObject();
+    }
+
+    template<typename TStream>
+    void WriteJsonStream(const Document& gltfDocument, const ExtensionSerializer& extensionSerializer, TStream& stream, SerializeFlags flags)
+    {
+        if (HasFlag(flags, SerializeFlags::Pretty))
+        {
+            rapidjson::PrettyWriter<TStream> writer(stream);
+            WriteJson(gltfDocument, extensionSerializer, writer);
+        }
+        else
+        {
+            rapidjson::Writer<TStream> writer(stream);
+            WriteJson(gltfDocument, extensionSerializer, writer);
+        }
+
+        stream.Flush();
+    }
 }
 
 std::string Microsoft::glTF::Serialize(const Document& gltfDocument, SerializeFlags flags)
@@ -871,20 +1046,51 @@ std::string Microsoft::glTF::Serialize(const Document& gltfDocument, const Exten
     auto doc = CreateJsonDocument(gltfDocument, extensionSerializer);
 
     rapidjson::StringBuffer stringBuffer;
-    if (HasFlag(flags, SerializeFlags::Pretty))
-    {
-        rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(stringBuffer);
-        doc.Accept(writer);
-    }
-    else
-    {
-        rapidjson::Writer<rapidjson::StringBuffer> writer(stringBuffer);
-        doc.Accept(writer);
-    }
+    WriteJsonDocument(doc, stringBuffer, flags);
 
     return stringBuffer.GetString();
 }
 
+std::string Microsoft::glTF::Serialize(const Document& gltfDocument, JsonArena& arena, SerializeFlags flags)
+{
+    return Serialize(gltfDocument, arena, ExtensionSerializer(), flags);
+}
+
+std::string Microsoft::glTF::Serialize(const Document& gltfDocument, JsonArena& arena, const ExtensionSerializer& extensionSerializer, SerializeFlags flags)
+{
+    // Values allocated for the previous document are discarded
+    arena.Reset();
+
+    auto doc = CreateJsonDocument(gltfDocument, extensionSerializer, &arena.GetAllocator());
+
+    // The arena's string buffer retains its capacity between documents
+    auto& stringBuffer = arena.GetStringBuffer();
+    stringBuffer.Clear();
+
+    WriteJsonDocument(doc, stringBuffer, flags);
+
+    return std::string(stringBuffer.GetString(), stringBuffer.GetSize());
+}
+
+void Microsoft::glTF::Serialize(const Document& gltfDocument, std::ostream& stream, SerializeFlags flags)
+{
+    Serialize(gltfDocument, stream, ExtensionSerializer(), flags);
+}
+
+void Microsoft::glTF::Serialize(const Document& gltfDocument, std::ostream& stream, const ExtensionSerializer& extensionSerializer, SerializeFlags flags)
+{
+    OStreamBuffer streamBuffer(stream);
+    WriteJsonStream(gltfDocument, extensionSerializer, streamBuffer, flags);
+}
+
+size_t Microsoft::glTF::GetSerializedLength(const Document& gltfDocument, const ExtensionSerializer& extensionSerializer, SerializeFlags flags)
+{
+    CountingStream countingStream;
+    WriteJsonStream(gltfDocument, extensionSerializer, countingStream, flags);
+
+    return countingStream.GetLength();
+}
+
 SerializeFlags Microsoft::glTF::operator|(SerializeFlags lhs, SerializeFlags rhs)
 {
     const auto result =
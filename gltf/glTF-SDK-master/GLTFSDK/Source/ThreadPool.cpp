@@ -0,0 +1,141 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/ThreadPool.h>
+
+#include <GLTFSDK/Exceptions.h>
+
+#include <algorithm>
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    // The pool whose thread is the calling thread, if any
+    thread_local const ThreadPool* t_threadPool = nullptr;
+}
+
+ThreadPool::ThreadPool(size_t threadCount) : m_isStopping(false)
+{
+    if (threadCount == 0U)
+    {
+        threadCount = std::max<size_t>(1U, std::thread::hardware_concurrency());
+    }
+
+    m_threads.reserve(threadCount);
+
+    try
+    {
+        for (size_t i = 0U; i < threadCount; ++i)
+        {
+            m_threads.emplace_back(&ThreadPool::Run, this);
+        }
+    }
+    catch (...)
+    {
+        // The destructor isn't called if the constructor throws, and destroying a joinable std::thread
+        // terminates the program, so the threads that were started must be joined here
+        Stop();
+        throw;
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    Stop();
+}
+
+size_t ThreadPool::GetThreadCount() const
+{
+    return m_threads.size();
+}
+
+void ThreadPool::Execute(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_isStopping)
+        {
+            throw GLTFException("Cannot submit a task to a ThreadPool that is being destroyed");
+        }
+
+        m_tasks.push(std::move(task));
+    }
+
+    m_condition.notify_one();
+}
+
+bool ThreadPool::TryExecutePending()
+{
+    if (t_threadPool != this)
+    {
+        return false;
+    }
+
+    std::function<void()> task;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (!PopTask(task))
+        {
+            return false;
+        }
+    }
+
+    task();
+    return true;
+}
+
+void ThreadPool::Run()
+{
+    t_threadPool = this;
+
+    for (;;)
+    {
+        std::function<void()> task;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            m_condition.wait(lock, [this]() { return m_isStopping || !m_tasks.empty(); });
+
+            // Drain the queue before stopping so that no submitted task's future is left unsatisfied
+            if (!PopTask(task))
+            {
+                return;
+            }
+        }
+
+        task();
+    }
+}
+
+void ThreadPool::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopping = true;
+    }
+
+    m_condition.notify_all();
+
+    for (auto& thread : m_threads)
+    {
+        thread.join();
+    }
+}
+
+bool ThreadPool::PopTask(std::function<void()>& task)
+{
+    if (m_tasks.empty())
+    {
+        return false;
+    }
+
+    task = std::move(m_tasks.front());
+    m_tasks.pop();
+
+    return true;
+}